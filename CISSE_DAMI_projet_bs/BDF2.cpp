@@ -0,0 +1,170 @@
+/**
+ * @file BDF2.cpp
+ * @brief Implémentation des schémas BDF2 et TR_BDF2 dérivés de DifferenceFinie
+ */
+
+#include "DifferenceFinie.hpp"
+#include "Operateur.hpp"
+#include <cmath>
+#include <vector>
+
+/**
+ * @brief Matrice (I - w L) factorisée, avec son espace de travail
+ */
+struct SystemeFactorise
+{
+	std::vector<double> l, d, u;		  // Matrice (I - w L)
+	std::vector<double> c_prime, inv_pivot; // Factorisation de Thomas
+	double w;							  // Poids implicite
+
+	SystemeFactorise(int n, const std::vector<double> &a, const std::vector<double> &b, const std::vector<double> &c, double w_)
+		: l(n), d(n), u(n), c_prime(n), inv_pivot(n), w(w_)
+	{
+		matriceImplicite(n, a.data(), b.data(), c.data(), w, l.data(), d.data(), u.data());
+		thomasFactoriser(n, l.data(), d.data(), u.data(), c_prime.data(), inv_pivot.data());
+	}
+
+	/**
+	 * @brief Résout (I - w L) x = rhs, les bords de la couche V étant déjà fixés ; la solution est écrite dans V
+	 */
+	void resoudre(const std::vector<double> &a, const std::vector<double> &c, std::vector<double> &rhs,
+				  std::vector<double> &V, std::vector<double> &r_prime) const
+	{
+		int n = rhs.size();
+		injecterBords(n, a.data(), c.data(), w, V.data(), rhs.data());
+		thomasSubstituer(n, l.data(), c_prime.data(), inv_pivot.data(), rhs.data(), &V[1], r_prime.data());
+	}
+};
+
+/**
+ * @brief Fixe les conditions aux bords d'une couche au temps t
+ */
+static void fixerBords(const EDP &edp, double t, double Smax, double r, std::vector<double> &V)
+{
+	V[0] = edp.getOption().lowerBoundary(t, r);
+	V[V.size() - 1] = edp.getOption().upperBoundary(Smax, t, r);
+}
+
+/**
+ * @brief Résout l'EDP en utilisant le schéma BDF2
+ * @return Matrice des prix de l'option aux différents points de la grille
+ */
+std::vector<std::vector<double>> BDF2::solve()
+{
+	verifierParametresConstants("BDF2");
+
+	// Paramètres de l'actif
+	double r = getEDP().getActif().r_;
+	double sigma = getEDP().getActif().sigma_;
+
+	// taile du systeme
+	int size = N_ - 2;
+
+	// Opérateur de Black-Scholes sur les noeuds internes
+	std::vector<double> a(size), b(size), c(size);
+	operateurBlackScholes(N_, L_, dS_, sigma, r, a.data(), b.data(), c.data());
+
+	// Demi-pas implicites de démarrage et pas BDF2
+	SystemeFactorise demiPas(size, a, b, c, 0.5 * dt_);
+	SystemeFactorise pasBDF2(size, a, b, c, 2.0 * dt_ / 3.0);
+
+	std::vector<double> rhs(size), r_prime(size), milieu(N_);
+
+	// Matrice des prix
+	std::vector<std::vector<double>> V(M_, std::vector<double>(N_, 0.0));
+
+	// Condition terminale (payoff)
+	for (int i = 0; i < N_; ++i)
+	{
+		V[M_ - 1][i] = getEDP().getOption().payoff(L_[i]);
+	}
+
+	if (M_ < 2)
+		return V;
+
+	// Démarrage : deux demi-pas implicites de M-1 vers M-2
+	double Smax = L_[N_ - 1];
+	fixerBords(getEDP(), 0.5 * (t_[M_ - 2] + t_[M_ - 1]), Smax, r, milieu);
+	rhs.assign(V[M_ - 1].begin() + 1, V[M_ - 1].end() - 1);
+	demiPas.resoudre(a, c, rhs, milieu, r_prime);
+
+	fixerBords(getEDP(), t_[M_ - 2], Smax, r, V[M_ - 2]);
+	rhs.assign(milieu.begin() + 1, milieu.end() - 1);
+	demiPas.resoudre(a, c, rhs, V[M_ - 2], r_prime);
+
+	// Boucle BDF2 sur le temps (de T vers 0)
+	for (int m = M_ - 3; m >= 0; --m)
+	{
+		fixerBords(getEDP(), t_[m], Smax, r, V[m]);
+
+		const std::vector<double> &V1 = V[m + 1], &V2 = V[m + 2];
+		for (int i = 0; i < size; ++i)
+		{
+			rhs[i] = (4.0 * V1[i + 1] - V2[i + 1]) / 3.0;
+		}
+		pasBDF2.resoudre(a, c, rhs, V[m], r_prime);
+	}
+
+	return V;
+}
+
+/**
+ * @brief Résout l'EDP en utilisant le schéma TR-BDF2
+ * @return Matrice des prix de l'option aux différents points de la grille
+ */
+std::vector<std::vector<double>> TR_BDF2::solve()
+{
+	verifierParametresConstants("TR_BDF2");
+
+	// Paramètres de l'actif
+	double r = getEDP().getActif().r_;
+	double sigma = getEDP().getActif().sigma_;
+
+	// taile du systeme
+	int size = N_ - 2;
+
+	// Opérateur de Black-Scholes sur les noeuds internes
+	std::vector<double> a(size), b(size), c(size);
+	operateurBlackScholes(N_, L_, dS_, sigma, r, a.data(), b.data(), c.data());
+
+	// gamma = 2 - sqrt(2) : le pas trapèze (poids gamma dt / 2) et le pas BDF2
+	// (poids (1 - gamma) / (2 - gamma) dt) ont le même poids implicite
+	const double gamma = 2.0 - std::sqrt(2.0);
+	const double w = 0.5 * gamma * dt_;
+	const double coefIntermediaire = 1.0 / (gamma * (2.0 - gamma));
+	const double coefPrecedent = (1.0 - gamma) * (1.0 - gamma) / (gamma * (2.0 - gamma));
+	SystemeFactorise systeme(size, a, b, c, w);
+
+	std::vector<double> rhs(size), r_prime(size), intermediaire(N_);
+
+	// Matrice des prix
+	std::vector<std::vector<double>> V(M_, std::vector<double>(N_, 0.0));
+
+	// Condition terminale (payoff)
+	for (int i = 0; i < N_; ++i)
+	{
+		V[M_ - 1][i] = getEDP().getOption().payoff(L_[i]);
+	}
+
+	// Boucle sur le temps (de T vers 0)
+	double Smax = L_[N_ - 1];
+	for (int m = M_ - 2; m >= 0; --m)
+	{
+		const std::vector<double> &Vprec = V[m + 1];
+
+		// Étape trapèze sur gamma dt
+		fixerBords(getEDP(), t_[m + 1] - gamma * dt_, Smax, r, intermediaire);
+		appliquerOperateur(size, a.data(), b.data(), c.data(), w, Vprec.data(), rhs.data());
+		systeme.resoudre(a, c, rhs, intermediaire, r_prime);
+
+		// Étape BDF2 sur le pas complet
+		fixerBords(getEDP(), t_[m], Smax, r, V[m]);
+		for (int i = 0; i < size; ++i)
+		{
+			rhs[i] = coefIntermediaire * intermediaire[i + 1] - coefPrecedent * Vprec[i + 1];
+		}
+		systeme.resoudre(a, c, rhs, V[m], r_prime);
+	}
+
+	return V;
+}
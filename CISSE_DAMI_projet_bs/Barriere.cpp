@@ -0,0 +1,81 @@
+/**
+ * @file Barriere.cpp
+ * @brief Grilles tronquées à la barrière et parité activante / désactivante
+ */
+
+#include "DifferenceFinie.hpp"
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+#include <vector>
+
+/**
+ * @brief Grille uniforme tronquée à la barrière, qui en est un noeud extrême
+ * @param option Option à barrière
+ * @param Sautre Autre extrémité du domaine : prix minimal (0) pour une barrière haute, prix maximal pour une barrière basse
+ * @param N Nombre de points
+ * @return Grille des prix du sous-jacent
+ */
+std::vector<double> grilleBarriere(const OptionBarriere &option, double Sautre, int N)
+{
+	double B = option.getBarriere();
+	bool haute = option.getType() == Barriere::Haute;
+	if (N < 3 || (haute ? Sautre >= B || Sautre < 0.0 : Sautre <= B))
+	{
+		throw std::invalid_argument("grilleBarriere : domaine vide ou du mauvais côté de la barrière");
+	}
+
+	double Smin = haute ? Sautre : B;
+	double Smax = haute ? B : Sautre;
+	std::vector<double> S(N);
+	for (int j = 0; j < N; ++j)
+	{
+		S[j] = Smin + (Smax - Smin) * j / (N - 1);
+	}
+
+	// Noeud extrême exactement sur la barrière
+	(haute ? S[N - 1] : S[0]) = B;
+	return S;
+}
+
+/**
+ * @brief Prix de l'option activante par parité : activante = vanille - désactivante
+ * @param S Grille de la vanille
+ * @param vanille Prix de la vanille sur S
+ * @param option Option à barrière
+ * @param Sbarriere Grille uniforme de la désactivante (voir grilleBarriere)
+ * @param desactivante Prix de la désactivante sur Sbarriere
+ * @return Prix de l'option activante sur S
+ */
+std::vector<double> pariteActivante(const std::vector<double> &S, const std::vector<double> &vanille,
+									const OptionBarriere &option, const std::vector<double> &Sbarriere,
+									const std::vector<double> &desactivante)
+{
+	int nb = (int)Sbarriere.size();
+	double S0 = Sbarriere[0];
+	double dS = Sbarriere[1] - Sbarriere[0];
+	double marge = 1e-12 * std::max(std::fabs(S0), std::fabs(Sbarriere[nb - 1]));
+
+	// Hors de la barrière, chaque noeud de la vanille doit être couvert par la grille de la désactivante
+	for (size_t i = 0; i < S.size(); ++i)
+	{
+		if (!option.estTouchee(S[i]) && (S[i] < S0 - marge || S[i] > Sbarriere[nb - 1] + marge))
+		{
+			throw std::invalid_argument("pariteActivante : la grille de la vanille dépasse celle de la désactivante");
+		}
+	}
+
+	std::vector<double> activante(vanille);
+	for (size_t i = 0; i < S.size(); ++i)
+	{
+		// Au-delà de la barrière, l'activante est déjà activée : elle vaut la vanille
+		if (option.estTouchee(S[i]))
+		{
+			continue;
+		}
+		int j = std::max(0, std::min((int)((S[i] - S0) / dS), nb - 2));
+		double w = std::max(0.0, std::min((S[i] - Sbarriere[j]) / dS, 1.0));
+		activante[i] -= (1.0 - w) * desactivante[j] + w * desactivante[j + 1];
+	}
+	return activante;
+}
@@ -0,0 +1,222 @@
+/**
+ * @file CompactOrdre4.cpp
+ * @brief Implémentation du schéma compact d'ordre 4 dérivé de DifferenceFinie
+ */
+
+#include "DifferenceFinie.hpp"
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+#include <vector>
+
+/**
+ * @brief Grille logarithmiquement uniforme (pas constant en ln S)
+ * @param Smin Prix minimal, strictement positif
+ * @param Smax Prix maximal
+ * @param N Nombre de points
+ * @return Grille des prix du sous-jacent
+ */
+std::vector<double> grilleLog(double Smin, double Smax, int N)
+{
+	std::vector<double> S(N);
+	double h = std::log(Smax / Smin) / (N - 1);
+	for (int i = 0; i < N; ++i)
+	{
+		S[i] = Smin * std::exp(i * h);
+	}
+	S[N - 1] = Smax;
+	return S;
+}
+
+/**
+ * @brief Constructeur de la classe CompactOrdre4
+ */
+CompactOrdre4::CompactOrdre4(EDP &edp, int N, int M, const std::vector<double> &L, const std::vector<double> &t)
+	: DifferenceFinie(edp, N, M, L, t)
+{
+	if (L_[0] <= 0.0)
+	{
+		throw std::invalid_argument("CompactOrdre4 : la grille des prix doit être strictement positive");
+	}
+	h_ = std::log(L_[1] / L_[0]);
+	for (int i = 1; i < N_ - 1; ++i)
+	{
+		if (std::abs(std::log(L_[i + 1] / L_[i]) - h_) > 1e-6 * h_)
+		{
+			throw std::invalid_argument("CompactOrdre4 : la grille des prix doit être logarithmiquement uniforme");
+		}
+	}
+}
+
+/**
+ * @brief Stencil tridiagonal constant (coefficients en i-1, i, i+1)
+ */
+struct Stencil
+{
+	double m, z, p;
+};
+
+/**
+ * @brief Système (A - w C) V^m = (A + w' C) V^{m+1} factorisé une seule fois
+ */
+struct SystemeCompact
+{
+	Stencil gauche, droite;				  // A - w C et A + w' C
+	std::vector<double> l, c_prime, inv_pivot; // Factorisation de Thomas
+
+	SystemeCompact(int n, const Stencil &A, const Stencil &C, double wImpl, double wExpl)
+		: l(n, A.m - wImpl * C.m), c_prime(n), inv_pivot(n)
+	{
+		gauche = {A.m - wImpl * C.m, A.z - wImpl * C.z, A.p - wImpl * C.p};
+		droite = {A.m + wExpl * C.m, A.z + wExpl * C.z, A.p + wExpl * C.p};
+		std::vector<double> d(n, gauche.z), u(n, gauche.p);
+		thomasFactoriser(n, l.data(), d.data(), u.data(), c_prime.data(), inv_pivot.data());
+	}
+
+	/**
+	 * @brief Calcule la nouvelle couche Vnew (bords déjà fixés) à partir de Vold
+	 */
+	void avancer(const std::vector<double> &Vold, std::vector<double> &Vnew, std::vector<double> &rhs,
+				 std::vector<double> &r_prime) const
+	{
+		int n = rhs.size();
+		for (int i = 0; i < n; ++i)
+		{
+			rhs[i] = droite.m * Vold[i] + droite.z * Vold[i + 1] + droite.p * Vold[i + 2];
+		}
+		rhs[0] -= gauche.m * Vnew[0];
+		rhs[n - 1] -= gauche.p * Vnew[n + 1];
+		thomasSubstituer(n, l.data(), c_prime.data(), inv_pivot.data(), rhs.data(), &Vnew[1], r_prime.data());
+	}
+};
+
+/**
+ * @brief B-spline cubique sur [-2, 2]
+ */
+static double splineCubique(double z)
+{
+	z = std::abs(z);
+	if (z < 1.0)
+		return (4.0 - 6.0 * z * z + 3.0 * z * z * z) / 6.0;
+	if (z < 2.0)
+		return (2.0 - z) * (2.0 - z) * (2.0 - z) / 6.0;
+	return 0.0;
+}
+
+/**
+ * @brief Noyau de lissage de Kreiss d'ordre 4, de support [-3, 3]
+ *
+ * Transformée de Fourier (sin(w/2) / (w/2))^4 (1 + 2/3 sin^2(w/2)) = 1 + O(w^4) : la
+ * B-spline cubique seule ne conserve que les moments d'ordre 1 et dégraderait le schéma à l'ordre 2.
+ */
+static double noyauKreiss4(double z)
+{
+	return (4.0 / 3.0) * splineCubique(z) - (splineCubique(z - 1.0) + splineCubique(z + 1.0)) / 6.0;
+}
+
+/**
+ * @brief Payoff lissé au noeud x : intégrale de payoff(exp(x + h z)) Phi4(z) sur [-3, 3]
+ *
+ * L'intégrale est découpée aux noeuds du noyau et au point de non-dérivabilité zK,
+ * puis chaque morceau régulier est intégré par Gauss-Legendre à 5 points.
+ */
+static double payoffLisse(const Option &option, double x, double h, double zK)
+{
+	static const double noeuds[5] = {-0.9061798459386640, -0.5384693101056831, 0.0, 0.5384693101056831, 0.9061798459386640};
+	static const double poids[5] = {0.2369268850561891, 0.4786286704993665, 0.5688888888888889, 0.4786286704993665, 0.2369268850561891};
+
+	std::vector<double> bornes = {-3.0, -2.0, -1.0, 0.0, 1.0, 2.0, 3.0};
+	if (zK > -3.0 && zK < 3.0)
+	{
+		bornes.push_back(zK);
+	}
+	std::sort(bornes.begin(), bornes.end());
+
+	double somme = 0.0;
+	for (size_t k = 0; k + 1 < bornes.size(); ++k)
+	{
+		double milieu = 0.5 * (bornes[k] + bornes[k + 1]), demi = 0.5 * (bornes[k + 1] - bornes[k]);
+		for (int q = 0; q < 5; ++q)
+		{
+			double z = milieu + demi * noeuds[q];
+			somme += demi * poids[q] * noyauKreiss4(z) * option.payoff(std::exp(x + h * z));
+		}
+	}
+	return somme;
+}
+
+/**
+ * @brief Résout l'EDP en utilisant le schéma compact d'ordre 4
+ * @return Matrice des prix de l'option aux différents points de la grille
+ */
+std::vector<std::vector<double>> CompactOrdre4::solve()
+{
+	verifierParametresConstants("CompactOrdre4");
+
+	// Paramètres de l'actif
+	double r = getEDP().getActif().r_;
+	double sigma = getEDP().getActif().sigma_;
+	const Option &option = getEDP().getOption();
+
+	// taile du systeme
+	int size = N_ - 2;
+
+	// EDP en x = ln S : V_tau = alpha V_xx + beta V_x - r V
+	double alpha = 0.5 * sigma * sigma;
+	double beta = r - alpha;
+	double h = h_;
+
+	// A = I + h^2/12 (D2 + beta/alpha D1)
+	Stencil A = {1.0 / 12.0 - beta * h / (24.0 * alpha), 10.0 / 12.0, 1.0 / 12.0 + beta * h / (24.0 * alpha)};
+
+	// B = (alpha + h^2 beta^2 / (12 alpha)) D2 + beta D1, puis C = B - r A
+	double diffusion = (alpha + h * h * beta * beta / (12.0 * alpha)) / (h * h);
+	Stencil B = {diffusion - beta / (2.0 * h), -2.0 * diffusion, diffusion + beta / (2.0 * h)};
+	Stencil C = {B.m - r * A.m, B.z - r * A.z, B.p - r * A.p};
+
+	// Demi-pas implicites (démarrage de Rannacher) et pas de Crank-Nicholson
+	SystemeCompact demiPas(size, A, C, 0.5 * dt_, 0.0);
+	SystemeCompact pasCN(size, A, C, 0.5 * dt_, 0.5 * dt_);
+
+	std::vector<double> rhs(size), r_prime(size), milieu(N_);
+
+	// Condition au bord inférieur : la frontière de l'option est donnée en S = 0, on la
+	// translate jusqu'à Smin > 0 par la partie affine du payoff (exact pour Call et Put)
+	double Smin = L_[0], Smax = L_[N_ - 1];
+	double decalageBas = option.payoff(Smin) - option.payoff(0.0);
+	auto fixerBords = [&](double t, std::vector<double> &V)
+	{
+		V[0] = option.lowerBoundary(t, r) + decalageBas;
+		V[N_ - 1] = option.upperBoundary(Smax, t, r);
+	};
+
+	// Matrice des prix
+	std::vector<std::vector<double>> V(M_, std::vector<double>(N_, 0.0));
+
+	// Condition terminale (payoff), lissée à moins de 3h du strike
+	double xK = std::log(option.getK());
+	for (int i = 0; i < N_; ++i)
+	{
+		double x = std::log(L_[i]);
+		double zK = (xK - x) / h;
+		V[M_ - 1][i] = std::abs(zK) < 3.0 ? payoffLisse(option, x, h, zK) : option.payoff(L_[i]);
+	}
+
+	if (M_ < 2)
+		return V;
+
+	// Démarrage : deux demi-pas implicites de M-1 vers M-2
+	fixerBords(0.5 * (t_[M_ - 2] + t_[M_ - 1]), milieu);
+	demiPas.avancer(V[M_ - 1], milieu, rhs, r_prime);
+	fixerBords(t_[M_ - 2], V[M_ - 2]);
+	demiPas.avancer(milieu, V[M_ - 2], rhs, r_prime);
+
+	// Boucle de Crank-Nicholson sur le temps (de T vers 0)
+	for (int m = M_ - 3; m >= 0; --m)
+	{
+		fixerBords(t_[m], V[m]);
+		pasCN.avancer(V[m + 1], V[m], rhs, r_prime);
+	}
+
+	return V;
+}
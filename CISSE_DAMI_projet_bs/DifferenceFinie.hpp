@@ -1,12 +1,17 @@
 /**
  * @file DifferenceFinie.hpp
- * @brief Déclaration de la classe DifferenceFinie et ses classes dérivées concrètes Crank_Nicholson et Implicite
+ * @brief Déclaration de la classe DifferenceFinie, du theta-schéma (Crank_Nicholson, Implicite), des schémas BDF2, TR_BDF2 et CompactOrdre4
+ * et des grilles alignées sur les barrières
  */
 
 #ifndef DIFFERENCEFINIE_HPP
 #define DIFFERENCEFINIE_HPP
 
 #include "EDP.hpp"
+#include "Thomas.hpp"
+#include <cmath>
+#include <stdexcept>
+#include <string>
 #include <vector>
 
 /**
@@ -31,24 +36,77 @@ protected:
 	int M_;					// Nombre de points en temps
 	double dt_;				// Pas de temps
 	double dS_;				// Pas d'espace des prix
-	std::vector<double> L_; // Grille des prix du sous-jacent
-	std::vector<double> t_; // Grille des temps
+	const double *L_;		// Grille des prix du sous-jacent, non copiée
+	const double *t_;		// Grille des temps, non copiée
 public:
 	/**
 	 * @brief Constructeur de la classe DifferenceFinie
+	 *
+	 * Comme l'EDP, les grilles sont référencées et non copiées : elles doivent survivre au schéma.
+	 *
 	 * @param edp reference vers l'EDP associée à la méthode différence finie
 	 * @param N Nombre de points en espace
 	 * @param M Nombre de points en temps
-	 * @param dt Pas de temps
-	 * @param dS Pas d'espace des prix
-	 * @param L Grille des prix de l'actif sous-jacent
-	 * @param t Grille des temps
+	 * @param L Grille des prix de l'actif sous-jacent, N valeurs
+	 * @param t Grille des temps, M valeurs
 	 */
-	DifferenceFinie(EDP &edp, int N, int M, const std::vector<double> &L, const std::vector<double> &t)
+	DifferenceFinie(EDP &edp, int N, int M, const double *L, const double *t)
 		: edp_(edp), N_(N), M_(M), L_(L), t_(t)
 	{
 		dt_ = t_[1] - t_[0]; // Calcul du pas de temps en supposant une grille uniforme
 		dS_ = L_[1] - L_[0]; // Calcul du pas d'espace en supposant une grille uniforme
+		verifierBarriere();
+	}
+
+	/**
+	 * @brief Constructeur de la classe DifferenceFinie à partir de grilles en vecteurs, qui doivent survivre au schéma
+	 * @param edp reference vers l'EDP associée à la méthode différence finie
+	 * @param N Nombre de points en espace
+	 * @param M Nombre de points en temps
+	 * @param L Grille des prix de l'actif sous-jacent
+	 * @param t Grille des temps
+	 */
+	DifferenceFinie(EDP &edp, int N, int M, const std::vector<double> &L, const std::vector<double> &t)
+		: DifferenceFinie(edp, N, M, L.data(), t.data()) {}
+
+	/**
+	 * @brief Grilles temporaires interdites : le schéma n'en garde que l'adresse, qui pendrait aussitôt
+	 */
+	DifferenceFinie(EDP &edp, int N, int M, std::vector<double> &&L, const std::vector<double> &t) = delete;
+	DifferenceFinie(EDP &edp, int N, int M, const std::vector<double> &L, std::vector<double> &&t) = delete;
+	DifferenceFinie(EDP &edp, int N, int M, std::vector<double> &&L, std::vector<double> &&t) = delete;
+
+	/**
+	 * @brief Vérifie qu'une option à barrière a sa barrière sur le noeud extrême correspondant de la grille
+	 * @throw std::invalid_argument si la grille n'est pas tronquée à la barrière (voir grilleBarriere)
+	 */
+	void verifierBarriere() const
+	{
+		const OptionBarriere *barriere = dynamic_cast<const OptionBarriere *>(&edp_.getOption());
+		if (!barriere)
+		{
+			return;
+		}
+		double B = barriere->getBarriere();
+		double bord = barriere->getType() == Barriere::Haute ? L_[N_ - 1] : L_[0];
+		if (std::abs(bord - B) > 1e-9 * B)
+		{
+			throw std::invalid_argument("DifferenceFinie : la grille doit être tronquée à la barrière");
+		}
+	}
+
+	/**
+	 * @brief Vérifie que l'actif a des paramètres constants, pour les schémas qui ne gèrent pas sigma(S, t) et r(t)
+	 * @param schema Nom du schéma, pour le message d'erreur
+	 * @throw std::invalid_argument si une volatilité locale, une courbe de taux ou des dividendes sont renseignés
+	 */
+	void verifierParametresConstants(const char *schema) const
+	{
+		const Actif &actif = edp_.getActif();
+		if (actif.estVariable() || !actif.dividendes_.empty())
+		{
+			throw std::invalid_argument(std::string(schema) + " : volatilité locale, courbe de taux et dividendes non gérés");
+		}
 	}
 
 	/**
@@ -77,15 +135,15 @@ public:
 
 	/**
 	 * @brief Récupérer la grille des prix de l'actif sous-jacent
-	 * @return Grille des prix de l'actif sous-jacent
+	 * @return Grille des prix de l'actif sous-jacent, N valeurs
 	 */
-	const std::vector<double> &getL() const { return L_; }
+	const double *getL() const { return L_; }
 
 	/**
 	 * @brief Récupérer la grille des temps
-	 * @return Grille des temps
+	 * @return Grille des temps, M valeurs
 	 */
-	const std::vector<double> &getT() const { return t_; }
+	const double *getT() const { return t_; }
 
 	/**
 	 * @brief Destructeur virtuel de la classe DifferenceFinie
@@ -93,15 +151,196 @@ public:
 	virtual ~DifferenceFinie() {}
 };
 
+/**
+ * @struct TravailTheta
+ * @brief Mémoire de travail du theta-schéma, réutilisable d'une résolution à l'autre
+ *
+ * Dimensionnée par la première résolution qui l'utilise ; les suivantes, sur une grille de
+ * même taille, n'allouent plus.
+ */
+template <typename Real, typename Acc = Real>
+struct TravailTheta
+{
+	std::vector<double> diffusion, convection, sig2; // Tables des paramètres variables
+	std::vector<double> saut;						 // Dividendes ramenés aux noeuds de temps
+	std::vector<Acc> coef[2][3];					 // Coefficients de l'opérateur aux temps m + 1 et m
+	std::vector<Acc> l, d, u;						 // Matrice implicite
+	std::vector<Acc> c_prime, inv_pivot, r_prime;	 // Factorisation et substitution de Thomas
+	std::vector<Real> rhs, demi;					 // Second membre et couche des demi-pas de Rannacher
+	std::vector<Real> couche;						 // Seconde couche de solveInitiale
+
+	/**
+	 * @brief Dimensionne d'avance la mémoire d'une grille à paramètres constants, Rannacher compris
+	 * @param N Nombre de points en espace
+	 * @param M Nombre de points en temps
+	 */
+	void dimensionner(int N, int M)
+	{
+		for (auto &jeu : coef)
+			for (auto &v : jeu)
+				v.resize(N - 2);
+		for (std::vector<Acc> *v : {&l, &d, &u, &c_prime, &inv_pivot, &r_prime})
+			v->resize(N - 2);
+		rhs.resize(N - 2);
+		demi.resize(N);
+		couche.resize(N);
+		saut.resize(M);
+	}
+};
+
+/**
+ * @class ThetaSchema
+ * @brief Theta-schéma : V^m - theta dt L V^m = V^{m+1} + (1 - theta) dt L V^{m+1}
+ *
+ * theta = 0.5 donne Crank-Nicholson, theta = 1 le schéma implicite, theta = 0 le schéma explicite.
+ * À paramètres constants la matrice (I - theta dt L) est factorisée une seule fois, puis
+ * chaque pas de temps se réduit à un produit tridiagonal et une substitution de Thomas.
+ * C'est le schéma qui gère la volatilité locale, la courbe de taux et les dividendes discrets de l'Actif.
+ */
+class ThetaSchema : public DifferenceFinie
+{
+protected:
+	double theta_;					// Poids de la partie implicite
+	double tolerance_ = 0.0;		// Tolérance d'arrêt anticipé, 0 pour parcourir tous les pas
+	int nbRannacher_ = 0;			// Nombre de premiers pas remplacés par deux demi-pas implicites
+	mutable int pasEconomises_ = 0; // Pas de temps évités par l'arrêt anticipé lors de la dernière résolution
+
+	/**
+	 * @brief Moteur du theta-schéma, partagé par solveAs, solveInitiale et solveDans
+	 * @param couches Couches de prix de N valeurs : les M couches, ou deux utilisées en alternance
+	 * @param toutesCouches true si couches contient les M couches
+	 * @param travail Mémoire de travail, redimensionnée au besoin
+	 * @return Indice dans couches de la couche de la date initiale (0 si toutesCouches)
+	 */
+	template <typename Real, typename Acc>
+	int resoudre(Real *const *couches, bool toutesCouches, TravailTheta<Real, Acc> &travail) const;
+
+public:
+	/**
+	 * @brief Constructeur de la classe ThetaSchema, sur des grilles non copiées qui doivent survivre au schéma
+	 * @param edp reference vers l'EDP associée à la méthode différence finie
+	 * @param N Nombre de points en espace
+	 * @param M Nombre de points en temps
+	 * @param L Grille des prix de l'actif sous-jacent
+	 * @param t Grille des temps
+	 * @param theta Poids de la partie implicite, dans [0, 1]
+	 */
+	ThetaSchema(EDP &edp, int N, int M, const std::vector<double> &L, const std::vector<double> &t, double theta)
+		: DifferenceFinie(edp, N, M, L, t), theta_(theta) {}
+
+	/**
+	 * @brief Grilles temporaires interdites : le schéma n'en garde que l'adresse, qui pendrait aussitôt
+	 */
+	ThetaSchema(EDP &edp, int N, int M, std::vector<double> &&L, const std::vector<double> &t, double theta) = delete;
+	ThetaSchema(EDP &edp, int N, int M, const std::vector<double> &L, std::vector<double> &&t, double theta) = delete;
+	ThetaSchema(EDP &edp, int N, int M, std::vector<double> &&L, std::vector<double> &&t, double theta) = delete;
+
+	/**
+	 * @brief Constructeur de la classe ThetaSchema sur des grilles de l'appelant
+	 * @param edp reference vers l'EDP associée à la méthode différence finie
+	 * @param N Nombre de points en espace
+	 * @param M Nombre de points en temps
+	 * @param L Grille des prix de l'actif sous-jacent, N valeurs
+	 * @param t Grille des temps, M valeurs
+	 * @param theta Poids de la partie implicite, dans [0, 1]
+	 */
+	ThetaSchema(EDP &edp, int N, int M, const double *L, const double *t, double theta)
+		: DifferenceFinie(edp, N, M, L, t), theta_(theta) {}
+
+	/**
+	 * @brief Résout l'EDP en utilisant le theta-schéma
+	 * @return Matrice des prix de l'option aux différents points de la grille
+	 */
+	std::vector<std::vector<double>> solve() override;
+
+	/**
+	 * @brief Résout l'EDP en utilisant le theta-schéma dans le type scalaire choisi
+	 * @tparam Real Type de stockage (double ou float)
+	 * @tparam Acc Type d'accumulation de la récurrence de Thomas (float : Acc = Real, mixte : Real = float, Acc = double)
+	 * @return Matrice des prix de l'option aux différents points de la grille
+	 */
+	template <typename Real, typename Acc = Real>
+	std::vector<std::vector<Real>> solveAs() const;
+
+	/**
+	 * @brief Résout l'EDP en ne conservant que deux couches de prix, sans la matrice complète
+	 * @return Prix à la date initiale aux points de la grille
+	 */
+	std::vector<double> solveInitiale() const;
+
+	/**
+	 * @brief Résout l'EDP en ne conservant que deux couches, dans la mémoire de l'appelant
+	 *
+	 * Une fois travail dimensionné par une première résolution sur une grille de même
+	 * taille, la résolution n'alloue plus (hors volatilité locale).
+	 *
+	 * @param prix Prix à la date initiale, N valeurs écrites par la résolution
+	 * @param travail Mémoire de travail, réutilisable d'une résolution à l'autre
+	 */
+	void solveInitiale(double *prix, TravailTheta<double> &travail) const;
+
+	/**
+	 * @brief Résout l'EDP en écrivant toutes les couches dans la mémoire de l'appelant, sans la copier
+	 * @param couches M pointeurs vers des couches de N valeurs, la couche m recevant les prix en t_m
+	 * @param travail Mémoire de travail, réutilisable d'une résolution à l'autre
+	 */
+	void solveDans(double *const *couches, TravailTheta<double> &travail) const;
+
+	/**
+	 * @brief Active le démarrage de Rannacher : les premiers pas depuis l'échéance sont remplacés
+	 * chacun par deux demi-pas implicites, qui amortissent les oscillations de Crank-Nicholson
+	 * dues au point anguleux du payoff
+	 * @param nbPas Nombre de pas concernés (2 en général), 0 pour désactiver
+	 */
+	void setRannacher(int nbPas) { nbRannacher_ = nbPas; }
+
+	/**
+	 * @brief Récupérer le nombre de pas du démarrage de Rannacher
+	 * @return Nombre de pas, 0 si désactivé
+	 */
+	int getRannacher() const { return nbRannacher_; }
+
+	/**
+	 * @brief Active l'arrêt anticipé : la boucle en temps s'arrête dès que la solution ne varie plus
+	 *
+	 * Une fois l'écart maximal entre deux couches consécutives sous la tolérance, sa
+	 * décroissance d'un pas à l'autre (raison q) donne la variation restante jusqu'à t_0,
+	 * au plus ecart * q / (1 - q) ; la boucle s'arrête quand elle passe sous la tolérance et
+	 * les couches restantes reçoivent la dernière couche calculée. L'arrêt n'a lieu que si
+	 * aucun dividende ni changement de volatilité locale ou de taux ne reste à venir.
+	 *
+	 * @param tolerance Variation restante tolérée sur les prix, 0 pour désactiver
+	 */
+	void setTolerance(double tolerance) { tolerance_ = tolerance; }
+
+	/**
+	 * @brief Récupérer la tolérance d'arrêt anticipé
+	 * @return Tolérance, 0 si l'arrêt anticipé est désactivé
+	 */
+	double getTolerance() const { return tolerance_; }
+
+	/**
+	 * @brief Récupérer le nombre de pas de temps évités par l'arrêt anticipé lors de la dernière résolution
+	 * @return Nombre de pas évités
+	 */
+	int getPasEconomises() const { return pasEconomises_; }
+
+	/**
+	 * @brief Récupérer le poids de la partie implicite
+	 * @return theta
+	 */
+	double getTheta() const { return theta_; }
+};
+
 /**
  * @class Crank_Nicholson
- * @brief Classe représentant la méthode de Crank-Nicholson pour résoudre une EDP
+ * @brief Classe représentant la méthode de Crank-Nicholson pour résoudre une EDP (theta = 0.5)
  */
-class Crank_Nicholson : public DifferenceFinie
+class Crank_Nicholson : public ThetaSchema
 {
 public:
 	/**
-	 * @brief Constructeur de la classe Crank_Nicholson
+	 * @brief Constructeur de la classe Crank_Nicholson, sur des grilles non copiées qui doivent survivre au schéma
 	 * @param edp reference vers l'EDP associée à la méthode différence finie
 	 * @param N Nombre de points en espace
 	 * @param M Nombre de points en temps
@@ -109,35 +348,212 @@ public:
 	 * @param t Grille des temps
 	 */
 	Crank_Nicholson(EDP &edp, int N, int M, const std::vector<double> &L, const std::vector<double> &t)
+		: ThetaSchema(edp, N, M, L, t, 0.5) {}
+
+	/**
+	 * @brief Grilles temporaires interdites : le schéma n'en garde que l'adresse, qui pendrait aussitôt
+	 */
+	Crank_Nicholson(EDP &edp, int N, int M, std::vector<double> &&L, const std::vector<double> &t) = delete;
+	Crank_Nicholson(EDP &edp, int N, int M, const std::vector<double> &L, std::vector<double> &&t) = delete;
+	Crank_Nicholson(EDP &edp, int N, int M, std::vector<double> &&L, std::vector<double> &&t) = delete;
+
+	/**
+	 * @brief Constructeur de la classe Crank_Nicholson sur des grilles de l'appelant, non copiées
+	 * @param edp reference vers l'EDP associée à la méthode différence finie
+	 * @param N Nombre de points en espace
+	 * @param M Nombre de points en temps
+	 * @param L Grille des prix de l'actif sous-jacent, N valeurs
+	 * @param t Grille des temps, M valeurs
+	 */
+	Crank_Nicholson(EDP &edp, int N, int M, const double *L, const double *t)
+		: ThetaSchema(edp, N, M, L, t, 0.5) {}
+};
+
+/**
+ * @class Implicite
+ * @brief Classe représentant la méthode implicite pour résoudre une EDP (theta = 1)
+ */
+class Implicite : public ThetaSchema
+{
+public:
+	/**
+	 * @brief Constructeur de la classe Implicite, sur des grilles non copiées qui doivent survivre au schéma
+	 * @param edp reference vers l'EDP associée à la méthode différence finie
+	 * @param N Nombre de points en espace
+	 * @param M Nombre de points en temps
+	 * @param L Grille des prix de l'actif sous-jacent
+	 * @param t Grille des temps
+	 */
+	Implicite(EDP &edp, int N, int M, const std::vector<double> &L, const std::vector<double> &t)
+		: ThetaSchema(edp, N, M, L, t, 1.0) {}
+
+	/**
+	 * @brief Grilles temporaires interdites : le schéma n'en garde que l'adresse, qui pendrait aussitôt
+	 */
+	Implicite(EDP &edp, int N, int M, std::vector<double> &&L, const std::vector<double> &t) = delete;
+	Implicite(EDP &edp, int N, int M, const std::vector<double> &L, std::vector<double> &&t) = delete;
+	Implicite(EDP &edp, int N, int M, std::vector<double> &&L, std::vector<double> &&t) = delete;
+
+	/**
+	 * @brief Constructeur de la classe Implicite sur des grilles de l'appelant, non copiées
+	 * @param edp reference vers l'EDP associée à la méthode différence finie
+	 * @param N Nombre de points en espace
+	 * @param M Nombre de points en temps
+	 * @param L Grille des prix de l'actif sous-jacent, N valeurs
+	 * @param t Grille des temps, M valeurs
+	 */
+	Implicite(EDP &edp, int N, int M, const double *L, const double *t)
+		: ThetaSchema(edp, N, M, L, t, 1.0) {}
+};
+
+/**
+ * @class BDF2
+ * @brief Schéma BDF2 (différentiation rétrograde d'ordre 2) : (I - 2/3 dt L) V^m = (4 V^{m+1} - V^{m+2}) / 3
+ *
+ * Ordre 2 en temps et L-stable. Le premier pas est remplacé par deux demi-pas
+ * implicites (démarrage de Rannacher) qui amortissent la discontinuité du payoff.
+ */
+class BDF2 : public DifferenceFinie
+{
+public:
+	/**
+	 * @brief Constructeur de la classe BDF2, sur des grilles non copiées qui doivent survivre au schéma
+	 * @param edp reference vers l'EDP associée à la méthode différence finie
+	 * @param N Nombre de points en espace
+	 * @param M Nombre de points en temps
+	 * @param L Grille des prix de l'actif sous-jacent
+	 * @param t Grille des temps
+	 */
+	BDF2(EDP &edp, int N, int M, const std::vector<double> &L, const std::vector<double> &t)
 		: DifferenceFinie(edp, N, M, L, t) {}
 
 	/**
-	 * @brief Résout l'EDP en utilisant la méthode de Crank-Nicholson
+	 * @brief Grilles temporaires interdites : le schéma n'en garde que l'adresse, qui pendrait aussitôt
+	 */
+	BDF2(EDP &edp, int N, int M, std::vector<double> &&L, const std::vector<double> &t) = delete;
+	BDF2(EDP &edp, int N, int M, const std::vector<double> &L, std::vector<double> &&t) = delete;
+	BDF2(EDP &edp, int N, int M, std::vector<double> &&L, std::vector<double> &&t) = delete;
+
+	/**
+	 * @brief Résout l'EDP en utilisant le schéma BDF2
 	 * @return Matrice des prix de l'option aux différents points de la grille
 	 */
 	std::vector<std::vector<double>> solve() override;
 };
 
 /**
- * @class Implicite
- * @brief Classe représentant la méthode implicite pour résoudre une EDP
+ * @class TR_BDF2
+ * @brief Schéma TR-BDF2 : un pas trapèze sur gamma dt suivi d'un pas BDF2, avec gamma = 2 - sqrt(2)
+ *
+ * Ordre 2 en temps, L-stable : contrairement à Crank-Nicholson il n'oscille pas
+ * au voisinage du strike. Avec ce choix de gamma, les deux étapes partagent la même
+ * matrice, factorisée une seule fois.
  */
-class Implicite : public DifferenceFinie
+class TR_BDF2 : public DifferenceFinie
 {
 public:
 	/**
-	 * @brief Constructeur de la classe Implicite
+	 * @brief Constructeur de la classe TR_BDF2, sur des grilles non copiées qui doivent survivre au schéma
 	 * @param edp reference vers l'EDP associée à la méthode différence finie
 	 * @param N Nombre de points en espace
 	 * @param M Nombre de points en temps
 	 * @param L Grille des prix de l'actif sous-jacent
 	 * @param t Grille des temps
 	 */
-	Implicite(EDP &edp, int N, int M, const std::vector<double> &L, const std::vector<double> &t)
+	TR_BDF2(EDP &edp, int N, int M, const std::vector<double> &L, const std::vector<double> &t)
 		: DifferenceFinie(edp, N, M, L, t) {}
 
 	/**
-	 * @brief Résout l'EDP en utilisant la méthode implicite
+	 * @brief Grilles temporaires interdites : le schéma n'en garde que l'adresse, qui pendrait aussitôt
+	 */
+	TR_BDF2(EDP &edp, int N, int M, std::vector<double> &&L, const std::vector<double> &t) = delete;
+	TR_BDF2(EDP &edp, int N, int M, const std::vector<double> &L, std::vector<double> &&t) = delete;
+	TR_BDF2(EDP &edp, int N, int M, std::vector<double> &&L, std::vector<double> &&t) = delete;
+
+	/**
+	 * @brief Résout l'EDP en utilisant le schéma TR-BDF2
+	 * @return Matrice des prix de l'option aux différents points de la grille
+	 */
+	std::vector<std::vector<double>> solve() override;
+};
+
+/**
+ * @brief Grille uniforme tronquée à la barrière, qui en est un noeud extrême
+ * @param option Option à barrière
+ * @param Sautre Autre extrémité du domaine : prix minimal (0) pour une barrière haute, prix maximal pour une barrière basse
+ * @param N Nombre de points
+ * @return Grille des prix du sous-jacent
+ * @throw std::invalid_argument si Sautre est du mauvais côté de la barrière ou si N < 3
+ */
+std::vector<double> grilleBarriere(const OptionBarriere &option, double Sautre, int N);
+
+/**
+ * @brief Prix de l'option activante par parité : activante = vanille - désactivante
+ *
+ * La désactivante, calculée sur sa grille tronquée, est interpolée linéairement sur la
+ * grille de la vanille ; au-delà de la barrière, l'activante vaut la vanille. De l'autre
+ * côté, la grille de la vanille ne doit pas dépasser l'extrémité de celle de la désactivante
+ * (les deux grilles partagent typiquement cette extrémité).
+ *
+ * @param S Grille de la vanille
+ * @param vanille Prix de la vanille sur S
+ * @param option Option à barrière
+ * @param Sbarriere Grille uniforme de la désactivante (voir grilleBarriere)
+ * @param desactivante Prix de la désactivante sur Sbarriere
+ * @return Prix de l'option activante sur S
+ * @throw std::invalid_argument si un noeud de S hors de la barrière n'est pas couvert par Sbarriere
+ */
+std::vector<double> pariteActivante(const std::vector<double> &S, const std::vector<double> &vanille,
+									const OptionBarriere &option, const std::vector<double> &Sbarriere,
+									const std::vector<double> &desactivante);
+
+/**
+ * @brief Grille logarithmiquement uniforme (pas constant en ln S)
+ * @param Smin Prix minimal, strictement positif
+ * @param Smax Prix maximal
+ * @param N Nombre de points
+ * @return Grille des prix du sous-jacent
+ */
+std::vector<double> grilleLog(double Smin, double Smax, int N);
+
+/**
+ * @class CompactOrdre4
+ * @brief Schéma compact d'ordre 4 en espace (type Padé) sur une grille logarithmiquement uniforme
+ *
+ * En x = ln S l'EDP de Black-Scholes est à coefficients constants, ce qui permet un
+ * schéma compact d'ordre 4 dont les matrices restent tridiagonales :
+ * A dV/dtau = (B - r A) V avec A = I + h^2/12 (D2 + beta/alpha D1) et
+ * B = (alpha + h^2 beta^2 / (12 alpha)) D2 + beta D1, où alpha = sigma^2 / 2 et beta = r - sigma^2 / 2.
+ *
+ * Le temps est intégré par Crank-Nicholson avec un démarrage de Rannacher, et le payoff est
+ * lissé (noyau de Kreiss d'ordre 4) sur les noeuds voisins du strike pour préserver l'ordre.
+ * Comme pour les frontières, le point de non-dérivabilité du payoff est supposé en K.
+ */
+class CompactOrdre4 : public DifferenceFinie
+{
+protected:
+	double h_; // Pas en ln S
+public:
+	/**
+	 * @brief Constructeur de la classe CompactOrdre4, sur des grilles non copiées qui doivent survivre au schéma
+	 * @param edp reference vers l'EDP associée à la méthode différence finie
+	 * @param N Nombre de points en espace
+	 * @param M Nombre de points en temps
+	 * @param L Grille des prix du sous-jacent, strictement positive et logarithmiquement uniforme (voir grilleLog)
+	 * @param t Grille des temps
+	 * @throw std::invalid_argument si la grille n'est pas logarithmiquement uniforme
+	 */
+	CompactOrdre4(EDP &edp, int N, int M, const std::vector<double> &L, const std::vector<double> &t);
+
+	/**
+	 * @brief Grilles temporaires interdites : le schéma n'en garde que l'adresse, qui pendrait aussitôt
+	 */
+	CompactOrdre4(EDP &edp, int N, int M, std::vector<double> &&L, const std::vector<double> &t) = delete;
+	CompactOrdre4(EDP &edp, int N, int M, const std::vector<double> &L, std::vector<double> &&t) = delete;
+	CompactOrdre4(EDP &edp, int N, int M, std::vector<double> &&L, std::vector<double> &&t) = delete;
+
+	/**
+	 * @brief Résout l'EDP en utilisant le schéma compact d'ordre 4
 	 * @return Matrice des prix de l'option aux différents points de la grille
 	 */
 	std::vector<std::vector<double>> solve() override;
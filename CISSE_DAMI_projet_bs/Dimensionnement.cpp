@@ -0,0 +1,123 @@
+/**
+ * @file Dimensionnement.cpp
+ * @brief Implémentation du choix automatique de grille à partir d'une tolérance
+ */
+
+#include "Dimensionnement.hpp"
+#include "DifferenceFinie.hpp"
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+#include <vector>
+
+/**
+ * @brief Choisit la plus petite grille de Crank-Nicholson qui atteint la tolérance, puis résout dessus
+ * @param option Option à évaluer (hors options à barrière)
+ * @param actif Actif sous-jacent, évalué en S0_
+ * @param tolerance Erreur absolue visée sur la grandeur
+ * @param grandeur Prix, delta ou gamma en S0
+ * @return Grille retenue, grandeur calculée, erreur estimée et indicateur de tolérance atteinte
+ */
+Dimensionnement dimensionnerGrille(Option &option, Actif &actif, double tolerance, Grandeur grandeur)
+{
+	if (!(tolerance > 0.0))
+	{
+		throw std::invalid_argument("dimensionnerGrille : la tolérance doit être strictement positive");
+	}
+	if (dynamic_cast<const OptionBarriere *>(&option))
+	{
+		throw std::invalid_argument("dimensionnerGrille : options à barrière non gérées, voir grilleBarriere");
+	}
+	// Le domaine est tiré de sigma_ : sous une volatilité locale, ce n'est plus la volatilité de l'actif, et
+	// les pilotes de Richardson ne mesurent que l'erreur de discrétisation, pas celle de troncature
+	if (actif.estVariable())
+	{
+		throw std::invalid_argument("dimensionnerGrille : volatilité locale et courbe de taux non gérées");
+	}
+
+	const double T = option.getT(), S0 = actif.S0_;
+	const double echelle = std::max(S0, option.getK());
+	const int Nmax = 1 << 16, Mmax = 1 << 16;
+
+	// Domaine : c écarts-types en ln S, la troncature décroissant comme exp(-c^2 / 2)
+	double c = std::min(std::max(std::sqrt(2.0 * std::log(echelle / tolerance)), 3.0), 8.0);
+	double SmaxCible = echelle * std::exp(c * actif.sigma_ * std::sqrt(T));
+
+	// Grilles pilotes et retenue : N multiple de base, de sorte que S0 soit le noeud j0 N / base
+	const int base = 64;
+	int N0 = base, M0 = 16;
+	// j0 <= base / 2 : S0 reste un noeud intérieur (Smax >= 2 S0), avec des voisins de part et d'autre
+	int j0 = std::min(std::max(1, (int)std::lround(base * S0 / SmaxCible)), base / 2);
+	const double Smax = S0 * base / j0;
+
+	Dimensionnement res;
+	res.Smax = Smax;
+	res.resolutions = 0;
+
+	// Résout sur la grille (N, M) et renvoie la grandeur visée en S0
+	auto mesurer = [&](int N, int M)
+	{
+		res.S.resize(N + 1);
+		for (int j = 0; j <= N; ++j)
+			res.S[j] = j * Smax / N;
+		res.t.resize(M + 1);
+		for (int m = 0; m <= M; ++m)
+			res.t[m] = m * T / M;
+
+		EDPComplete edp(option, actif);
+		Crank_Nicholson schema(edp, N + 1, M + 1, res.S, res.t);
+		schema.setRannacher(2);
+		res.prix = schema.solveInitiale();
+		++res.resolutions;
+
+		int j = j0 * (N / base);
+		if (j < 1 || j + 1 > N)
+		{
+			throw std::invalid_argument("dimensionnerGrille : S0 n'est pas un noeud intérieur de la grille");
+		}
+		double dS = Smax / N;
+		const std::vector<double> &V = res.prix;
+		switch (grandeur)
+		{
+		case Grandeur::Delta:
+			return (V[j + 1] - V[j - 1]) / (2.0 * dS);
+		case Grandeur::Gamma:
+			return (V[j + 1] - 2.0 * V[j] + V[j - 1]) / (dS * dS);
+		default:
+			return V[j];
+		}
+	};
+
+	for (int essai = 0;; ++essai)
+	{
+		// Erreur a dS^2 + b dt^2 estimée par différences entre pilotes
+		double h0 = Smax / N0, k0 = T / M0;
+		double q00 = mesurer(N0, M0);
+		double q10 = mesurer(2 * N0, M0);
+		double q11 = mesurer(2 * N0, 2 * M0);
+		double a = std::abs(q00 - q10) / (0.75 * h0 * h0);
+		double b = std::abs(q10 - q11) / (0.75 * k0 * k0);
+		double extrapolee = q11 - (q00 - q10) / 3.0 - (q10 - q11) / 3.0;
+
+		// Plus grands pas répartissant la tolérance entre espace et temps, N multiple de base
+		double h = a > 0.0 ? std::sqrt(0.5 * tolerance / a) : Smax;
+		double k = b > 0.0 ? std::sqrt(0.5 * tolerance / b) : T;
+		res.N = std::min(base * std::max(1, (int)std::ceil(Smax / h / base)), Nmax);
+		res.M = std::min(std::max(1, (int)std::ceil(T / k)), Mmax);
+
+		double dS = Smax / res.N, dt = T / res.M;
+		res.valeur = mesurer(res.N, res.M);
+		res.erreur = a * dS * dS + b * dt * dt;
+
+		// Confirmation : écart à l'extrapolation de Richardson des pilotes
+		double ecart = std::abs(res.valeur - extrapolee);
+		if (ecart <= tolerance || essai == 3 || res.N == Nmax || res.M == Mmax)
+		{
+			res.erreur = std::max(res.erreur, ecart);
+			res.atteinte = res.erreur <= tolerance;
+			return res;
+		}
+		N0 *= 2;
+		M0 *= 2;
+	}
+}
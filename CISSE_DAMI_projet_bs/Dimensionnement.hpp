@@ -0,0 +1,62 @@
+/**
+ * @file Dimensionnement.hpp
+ * @brief Choix automatique du domaine et des pas de la grille de Crank-Nicholson à partir d'une tolérance
+ */
+
+#ifndef DIMENSIONNEMENT_HPP
+#define DIMENSIONNEMENT_HPP
+
+#include "EDP.hpp"
+#include <vector>
+
+/**
+ * @brief Grandeur dont la précision est visée, évaluée en S0
+ */
+enum class Grandeur
+{
+	Prix,
+	Delta,
+	Gamma
+};
+
+/**
+ * @struct Dimensionnement
+ * @brief Grille retenue pour une tolérance donnée et résultat calculé sur cette grille
+ */
+struct Dimensionnement
+{
+	int N;						// Nombre d'intervalles en S (N + 1 points)
+	int M;						// Nombre de pas de temps (M + 1 points)
+	double Smax;				// Borne supérieure du domaine, choisie pour que S0 soit un noeud
+	double valeur;				// Grandeur visée, calculée sur la grille retenue
+	double erreur;				// Erreur estimée sur cette grandeur
+	bool atteinte;				// Tolérance atteinte ; false si les raffinements ou la taille maximale sont épuisés avant
+	int resolutions;			// Nombre de résolutions effectuées, pilotes compris
+	std::vector<double> S;		// Grille des prix du sous-jacent
+	std::vector<double> t;		// Grille des temps
+	std::vector<double> prix;	// Prix à la date initiale sur S
+};
+
+/**
+ * @brief Choisit la plus petite grille de Crank-Nicholson qui atteint la tolérance, puis résout dessus
+ *
+ * Le domaine [0, Smax] est borné à max(S0, K) exp(c sigma sqrt(T)), c croissant avec la
+ * précision demandée. Avec le démarrage de Rannacher, qui supprime les oscillations de
+ * Crank-Nicholson quand dt est grand devant dS^2, l'erreur est de la forme a dS^2 + b dt^2 :
+ * trois résolutions pilotes sur des grilles grossières, (N0, M0), (2 N0, M0) et (2 N0, 2 M0),
+ * donnent a et b, d'où les plus grands pas qui répartissent la tolérance entre espace et temps. La résolution
+ * finale est confrontée à l'extrapolation de Richardson des pilotes ; si l'écart dépasse la
+ * tolérance, les pilotes sont raffinés et l'estimation recommencée. Après quatre essais, ou si
+ * la grille atteint sa taille maximale, le dernier résultat est renvoyé avec atteinte = false.
+ *
+ * @param option Option à évaluer (hors options à barrière, voir grilleBarriere)
+ * @param actif Actif sous-jacent, évalué en S0_, à volatilité sigma_ et taux r_ constants
+ * @param tolerance Erreur absolue visée sur la grandeur
+ * @param grandeur Prix, delta ou gamma en S0
+ * @return Grille retenue, grandeur calculée, erreur estimée et indicateur de tolérance atteinte
+ * @throw std::invalid_argument si la tolérance n'est pas strictement positive, si l'option est à barrière ou si
+ *        l'actif a une volatilité locale ou une courbe de taux (domaine non dimensionnable à partir de sigma_)
+ */
+Dimensionnement dimensionnerGrille(Option &option, Actif &actif, double tolerance, Grandeur grandeur = Grandeur::Prix);
+
+#endif
@@ -0,0 +1,223 @@
+/**
+ * @file Dupire.cpp
+ * @brief Implémentation du solveur de l'équation forward de Dupire
+ */
+
+#include "Dupire.hpp"
+#include "Marche.hpp"
+#include "Operateur.hpp"
+#include "Thomas.hpp"
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+#include <vector>
+
+/**
+ * @brief Constructeur de la classe Dupire
+ * @param actif Actif sous-jacent, doit survivre au solveur
+ * @param K Grille uniforme des strikes, encadrant S0
+ * @param T Grille uniforme des maturités, commençant en 0
+ */
+Dupire::Dupire(const Actif &actif, const std::vector<double> &K, const std::vector<double> &T)
+	: actif_(actif), K_(K), T_(T)
+{
+	if (K_.size() < 3 || T_.size() < 2)
+	{
+		throw std::invalid_argument("Dupire : grilles trop petites");
+	}
+	if (T_[0] != 0.0)
+	{
+		throw std::invalid_argument("Dupire : la grille des maturités doit commencer en 0");
+	}
+	if (K_[0] < 0.0 || !(actif_.S0_ > K_[0] && actif_.S0_ < K_.back()))
+	{
+		throw std::invalid_argument("Dupire : la grille des strikes doit être positive et encadrer S0");
+	}
+	if (!actif_.dividendes_.empty())
+	{
+		throw std::invalid_argument("Dupire : dividendes discrets non gérés");
+	}
+}
+
+/**
+ * @brief Facteur d'actualisation jusqu'à une maturité
+ * @param T Maturité
+ * @return D(T) = exp(-intégrale de r sur [0, T])
+ */
+double Dupire::actualisation(double T) const
+{
+	const CourbeTaux *courbe = actif_.courbeTaux_.get();
+	double r = courbe && T > 0.0 ? courbe->tauxMoyen(0.0, T) : actif_.r_;
+	return std::exp(-r * T);
+}
+
+/**
+ * @brief Résout l'équation de Dupire de T = 0 jusqu'à la dernière maturité
+ * @return Prix des calls, indicés [m][j] pour la maturité T_m et le strike K_j
+ */
+std::vector<std::vector<double>> Dupire::solve() const
+{
+	const VolLocale *vol = actif_.volLocale_.get();
+	const CourbeTaux *courbe = actif_.courbeTaux_.get();
+	const int N = (int)K_.size(), M = (int)T_.size(), n = N - 2;
+	const double dK = K_[1] - K_[0], dT = T_[1] - T_[0];
+	const double S0 = actif_.S0_;
+
+	// Facteurs géométriques en K, indépendants de sigma et r
+	std::vector<double> diffusion(n), convection(n), sig2(n, actif_.sigma_ * actif_.sigma_);
+	facteursBlackScholes(N, K_.data(), dK, diffusion.data(), convection.data());
+	VolLocale::IndexS index;
+	if (vol)
+	{
+		index = vol->indexer(&K_[1], n);
+	}
+
+	// Coefficients de l'opérateur à la maturité T
+	auto construire = [&](double T, std::vector<double> *abc)
+	{
+		if (vol)
+		{
+			int l;
+			double w;
+			vol->positionTemps(T, l, w);
+			vol->carreLigne(index, l, w, sig2.data());
+		}
+		double r = courbe ? courbe->taux(T) : actif_.r_;
+		operateurDupire(n, diffusion.data(), convection.data(), sig2.data(), r, abc[0].data(), abc[1].data(), abc[2].data());
+	};
+
+	// Bords : call très en dedans (prix forward actualisé) ou très en dehors
+	auto fixerBords = [&](double T, double *C)
+	{
+		double D = actualisation(T);
+		C[0] = std::max(S0 - K_[0] * D, 0.0);
+		C[N - 1] = std::max(S0 - K_[N - 1] * D, 0.0);
+	};
+
+	// Deux jeux de coefficients : à la maturité précédente (explicite) et courante (implicite)
+	std::vector<double> coef[2][3];
+	for (auto &jeu : coef)
+		for (auto &v : jeu)
+			v.resize(n);
+
+	// Matrice (I - dT/2 L), factorisation et espace de travail de Thomas
+	std::vector<double> l(n), d(n), u(n), c_prime(n), inv_pivot(n), r_prime(n), rhs(n), demi(N);
+	const double w = 0.5 * dT;
+	const bool constant = !actif_.estVariable();
+
+	// Condition initiale : valeur intrinsèque au spot du jour
+	std::vector<std::vector<double>> C(M, std::vector<double>(N));
+	for (int j = 0; j < N; ++j)
+	{
+		C[0][j] = std::max(S0 - K_[j], 0.0);
+	}
+
+	int prec = 0;
+	construire(T_[0], coef[prec]);
+	bool factorisee = false;
+
+	// Boucle en maturité (de 0 vers Tmax)
+	for (int m = 1; m < M; ++m)
+	{
+		int cour = constant ? prec : 1 - prec;
+		if (!constant)
+		{
+			construire(T_[m], coef[cour]);
+		}
+		const std::vector<double> *abc = coef[cour], *abcPrec = coef[prec];
+		fixerBords(T_[m], C[m].data());
+
+		if (m - 1 < nbRannacher_)
+		{
+			// Démarrage de Rannacher : deux demi-pas implicites amortissent le point anguleux en S0
+			double TDemi = 0.5 * (T_[m - 1] + T_[m]);
+			const std::vector<double> *abcDemi = abc;
+			if (!constant)
+			{
+				construire(TDemi, coef[prec]);
+				abcDemi = coef[prec];
+			}
+			fixerBords(TDemi, demi.data());
+			std::copy(C[m - 1].begin() + 1, C[m - 1].end() - 1, rhs.begin());
+			injecterBords(n, abcDemi[0].data(), abcDemi[2].data(), w, demi.data(), rhs.data());
+			resoudreImplicite(n, abcDemi[0].data(), abcDemi[1].data(), abcDemi[2].data(), w, rhs.data(), &demi[1], c_prime.data(), r_prime.data());
+			std::copy(demi.begin() + 1, demi.end() - 1, rhs.begin());
+			injecterBords(n, abc[0].data(), abc[2].data(), w, C[m].data(), rhs.data());
+			resoudreImplicite(n, abc[0].data(), abc[1].data(), abc[2].data(), w, rhs.data(), &C[m][1], c_prime.data(), r_prime.data());
+		}
+		else
+		{
+			// Crank-Nicholson : partie explicite à la maturité précédente, implicite à la courante
+			appliquerOperateur(n, abcPrec[0].data(), abcPrec[1].data(), abcPrec[2].data(), 0.5 * dT, C[m - 1].data(), rhs.data());
+			injecterBords(n, abc[0].data(), abc[2].data(), w, C[m].data(), rhs.data());
+			if (constant)
+			{
+				if (!factorisee)
+				{
+					matriceImplicite(n, abc[0].data(), abc[1].data(), abc[2].data(), w, l.data(), d.data(), u.data());
+					thomasFactoriser(n, l.data(), d.data(), u.data(), c_prime.data(), inv_pivot.data());
+					factorisee = true;
+				}
+				thomasSubstituer(n, l.data(), c_prime.data(), inv_pivot.data(), rhs.data(), &C[m][1], r_prime.data());
+			}
+			else
+			{
+				resoudreImplicite(n, abc[0].data(), abc[1].data(), abc[2].data(), w, rhs.data(), &C[m][1], c_prime.data(), r_prime.data());
+			}
+		}
+		prec = cour;
+	}
+	return C;
+}
+
+/**
+ * @brief Prix d'un call interpolé bilinéairement en (K, T) sur la surface renvoyée par solve
+ * @param C Surface des calls, indicée [m][j]
+ * @param K Strike, dans la grille
+ * @param T Maturité, dans la grille
+ * @return Prix du call
+ */
+double Dupire::prixCall(const std::vector<std::vector<double>> &C, double K, double T) const
+{
+	const int N = (int)K_.size(), M = (int)T_.size();
+	if (!(K >= K_[0] && K <= K_[N - 1] && T >= T_[0] && T <= T_[M - 1]))
+	{
+		throw std::invalid_argument("Dupire : strike ou maturité hors de la grille");
+	}
+	double dK = K_[1] - K_[0], dT = T_[1] - T_[0];
+	int j = std::min((int)((K - K_[0]) / dK), N - 2);
+	int m = std::min((int)((T - T_[0]) / dT), M - 2);
+	double x = (K - K_[j]) / dK, y = (T - T_[m]) / dT;
+	return (1.0 - y) * ((1.0 - x) * C[m][j] + x * C[m][j + 1]) + y * ((1.0 - x) * C[m + 1][j] + x * C[m + 1][j + 1]);
+}
+
+/**
+ * @brief Prix d'un put par parité call-put à partir de la surface des calls
+ * @param C Surface des calls, indicée [m][j]
+ * @param K Strike, dans la grille
+ * @param T Maturité, dans la grille
+ * @return Prix du put
+ */
+double Dupire::prixPut(const std::vector<std::vector<double>> &C, double K, double T) const
+{
+	return prixCall(C, K, T) - actif_.S0_ + K * actualisation(T);
+}
+
+/**
+ * @brief Prix d'une option de la chaîne, lue sur la surface à son strike et à sa maturité
+ * @param C Surface des calls, indicée [m][j]
+ * @param option Call ou Put européen
+ * @return Prix de l'option
+ */
+double Dupire::prix(const std::vector<std::vector<double>> &C, const Option &option) const
+{
+	if (dynamic_cast<const Call *>(&option))
+	{
+		return prixCall(C, option.getK(), option.getT());
+	}
+	if (dynamic_cast<const Put *>(&option))
+	{
+		return prixPut(C, option.getK(), option.getT());
+	}
+	throw std::invalid_argument("Dupire : seuls les Call et Put européens sont lus sur la surface");
+}
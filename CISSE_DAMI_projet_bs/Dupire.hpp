@@ -0,0 +1,110 @@
+/**
+ * @file Dupire.hpp
+ * @brief Déclaration du solveur de l'équation forward de Dupire : toute la surface de prix (K, T) en une résolution
+ */
+
+#ifndef DUPIRE_HPP
+#define DUPIRE_HPP
+
+#include "Option.hpp"
+#include <vector>
+
+/**
+ * @class Dupire
+ * @brief Résolution de l'équation forward de Dupire en (K, T), depuis le spot du jour
+ *
+ * dC/dT = 1/2 sigma^2(K, T) K^2 C_KK - r(T) K C_K,  C(K, 0) = max(S0 - K, 0)
+ *
+ * Là où l'EDP de Black-Scholes part du payoff d'un contrat (K, T) et remonte le temps, cette
+ * équation part du spot S0 et avance en maturité : une seule résolution donne le prix des
+ * calls pour tous les strikes et toutes les maturités de la grille. Les puts s'en déduisent
+ * par parité, P = C - S0 + K D(T), D étant le facteur d'actualisation.
+ *
+ * Le temps est intégré par Crank-Nicholson avec démarrage de Rannacher (le prix initial a un
+ * point anguleux en K = S0), avec les noyaux tridiagonaux des autres schémas (Operateur.hpp,
+ * Thomas.hpp). À paramètres constants la matrice est factorisée une fois ; avec une
+ * volatilité locale sigma(K, T) (VolLocale, lue en K) ou une courbe de taux r(T), l'opérateur
+ * est reconstruit à chaque pas sans allocation.
+ *
+ * Bords : C = max(S0 - K D(T), 0) aux deux extrémités de la grille des strikes (S0 en K = 0).
+ */
+class Dupire
+{
+private:
+	const Actif &actif_;	 // Actif sous-jacent : S0, taux ou courbe de taux, volatilité ou volatilité locale
+	std::vector<double> K_;	 // Grille uniforme des strikes
+	std::vector<double> T_;	 // Grille uniforme des maturités, commençant en 0
+	int nbRannacher_ = 2;	 // Nombre de premiers pas remplacés par deux demi-pas implicites
+
+public:
+	/**
+	 * @brief Constructeur de la classe Dupire
+	 * @param actif Actif sous-jacent, doit survivre au solveur
+	 * @param K Grille uniforme des strikes (au moins 3 points, positifs), encadrant S0
+	 * @param T Grille uniforme des maturités, commençant en 0 (au moins 2 points)
+	 * @throw std::invalid_argument si les grilles sont trop petites ou mal placées, ou si l'actif a des dividendes
+	 */
+	Dupire(const Actif &actif, const std::vector<double> &K, const std::vector<double> &T);
+
+	/**
+	 * @brief Résout l'équation de Dupire de T = 0 jusqu'à la dernière maturité
+	 * @return Prix des calls, indicés [m][j] pour la maturité T_m et le strike K_j
+	 */
+	std::vector<std::vector<double>> solve() const;
+
+	/**
+	 * @brief Prix d'un call interpolé bilinéairement en (K, T) sur la surface renvoyée par solve
+	 * @param C Surface des calls, indicée [m][j]
+	 * @param K Strike, dans la grille
+	 * @param T Maturité, dans la grille
+	 * @return Prix du call
+	 * @throw std::invalid_argument si (K, T) est hors de la grille
+	 */
+	double prixCall(const std::vector<std::vector<double>> &C, double K, double T) const;
+
+	/**
+	 * @brief Prix d'un put par parité call-put à partir de la surface des calls
+	 * @param C Surface des calls, indicée [m][j]
+	 * @param K Strike, dans la grille
+	 * @param T Maturité, dans la grille
+	 * @return Prix du put
+	 * @throw std::invalid_argument si (K, T) est hors de la grille
+	 */
+	double prixPut(const std::vector<std::vector<double>> &C, double K, double T) const;
+
+	/**
+	 * @brief Prix d'une option de la chaîne, lue sur la surface à son strike et à sa maturité
+	 * @param C Surface des calls, indicée [m][j]
+	 * @param option Call ou Put européen
+	 * @return Prix de l'option
+	 * @throw std::invalid_argument si l'option n'est ni un Call ni un Put, ou si (K, T) est hors de la grille
+	 */
+	double prix(const std::vector<std::vector<double>> &C, const Option &option) const;
+
+	/**
+	 * @brief Facteur d'actualisation jusqu'à une maturité
+	 * @param T Maturité
+	 * @return D(T) = exp(-intégrale de r sur [0, T])
+	 */
+	double actualisation(double T) const;
+
+	/**
+	 * @brief Fixe le nombre de pas du démarrage de Rannacher (2 par défaut)
+	 * @param nbPas Nombre de pas concernés, 0 pour du Crank-Nicholson pur
+	 */
+	void setRannacher(int nbPas) { nbRannacher_ = nbPas; }
+
+	/**
+	 * @brief Récupérer la grille des strikes
+	 * @return Grille des strikes
+	 */
+	const std::vector<double> &getK() const { return K_; }
+
+	/**
+	 * @brief Récupérer la grille des maturités
+	 * @return Grille des maturités
+	 */
+	const std::vector<double> &getT() const { return T_; }
+};
+
+#endif
@@ -0,0 +1,275 @@
+/**
+ * @file Heston.cpp
+ * @brief Implémentation du solveur ADI de Douglas pour l'EDP de Heston
+ */
+
+#include "Heston.hpp"
+#include "Operateur.hpp"
+#include "Thomas.hpp"
+#include <algorithm>
+#include <atomic>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+namespace
+{
+
+/**
+ * @class Rendezvous
+ * @brief Barrière réutilisable entre les threads d'une résolution
+ *
+ * Le dernier arrivé passe à la génération suivante et libère les autres, qui attendent en
+ * boucle courte avant de céder le processeur (yield), ce qui reste correct quand les
+ * threads sont plus nombreux que les coeurs.
+ */
+class Rendezvous
+{
+private:
+	const int nb_;						// Nombre de threads attendus
+	std::atomic<int> arrives_;			// Threads arrivés à la génération courante
+	std::atomic<unsigned> generation_;	// Numéro de la génération courante
+
+public:
+	/**
+	 * @brief Constructeur de la classe Rendezvous
+	 * @param nb Nombre de threads attendus à chaque passage
+	 */
+	explicit Rendezvous(int nb) : nb_(nb), arrives_(0), generation_(0) {}
+
+	/**
+	 * @brief Attend que les nb threads soient arrivés
+	 */
+	void attendre()
+	{
+		unsigned generation = generation_.load(std::memory_order_acquire);
+		if (arrives_.fetch_add(1, std::memory_order_acq_rel) == nb_ - 1)
+		{
+			arrives_.store(0, std::memory_order_relaxed);
+			generation_.fetch_add(1, std::memory_order_release);
+			return;
+		}
+		for (int k = 0; generation_.load(std::memory_order_acquire) == generation; ++k)
+		{
+			if (k >= 256)
+			{
+				std::this_thread::yield();
+			}
+		}
+	}
+};
+
+} // namespace
+
+/**
+ * @brief Constructeur de la classe Heston
+ * @param option Option à évaluer, doit survivre au solveur
+ * @param actif Actif sous-jacent : seul le taux r_ est utilisé
+ * @param p Paramètres de la variance
+ * @param S Grille uniforme des prix du sous-jacent
+ * @param v Grille uniforme des variances, commençant en 0
+ * @param t Grille uniforme des temps
+ * @param nbThreads Nombre de threads, 0 pour le nombre de coeurs disponibles
+ */
+Heston::Heston(const Option &option, const Actif &actif, const ParametresHeston &p, const std::vector<double> &S,
+			   const std::vector<double> &v, const std::vector<double> &t, int nbThreads)
+	: option_(option), r_(actif.r_), p_(p), S_(S), v_(v), t_(t), nbThreads_(nbThreads)
+{
+	if (S_.size() < 3 || v_.size() < 3 || t_.size() < 2)
+	{
+		throw std::invalid_argument("Heston : grilles trop petites");
+	}
+	if (v_[0] != 0.0)
+	{
+		throw std::invalid_argument("Heston : la grille des variances doit commencer en 0");
+	}
+	if (actif.estVariable() || !actif.dividendes_.empty())
+	{
+		throw std::invalid_argument("Heston : volatilité locale, courbe de taux et dividendes non gérés");
+	}
+	if (nbThreads_ <= 0)
+	{
+		nbThreads_ = std::max(1u, std::thread::hardware_concurrency());
+	}
+}
+
+/**
+ * @brief Résout l'EDP de Heston de l'échéance jusqu'à la date initiale
+ * @return Prix à la date initiale, indicés [j][i] pour la variance v_j et le prix S_i
+ */
+std::vector<std::vector<double>> Heston::solve() const
+{
+	const int ns = (int)S_.size(), nv = (int)v_.size(), M = (int)t_.size();
+	const int n1 = ns - 2; // Inconnues par ligne en S (bords de Dirichlet exclus)
+	const double dS = S_[1] - S_[0], dv = v_[1] - v_[0], dt = t_[1] - t_[0];
+	const double w = 0.5 * dt; // Poids implicite des corrections (theta = 1/2)
+	const double kappa = p_.kappa, theta = p_.theta, sigma = p_.sigma, rho = p_.rho;
+
+	// A1 (direction S) sur chaque ligne de variance, indicé [j * ns + i]
+	std::vector<double> a1(nv * ns, 0.0), b1(nv * ns, 0.0), c1(nv * ns, 0.0);
+	// A0 (dérivée croisée), nul sur les bords en v
+	std::vector<double> mu(nv * ns, 0.0);
+	for (int j = 0; j < nv; ++j)
+	{
+		for (int i = 1; i < ns - 1; ++i)
+		{
+			double alpha = 0.5 * v_[j] * S_[i] * S_[i] / (dS * dS);
+			double beta = 0.5 * r_ * S_[i] / dS;
+			a1[j * ns + i] = alpha - beta;
+			b1[j * ns + i] = -2.0 * alpha - 0.5 * r_;
+			c1[j * ns + i] = alpha + beta;
+			if (j > 0 && j < nv - 1)
+			{
+				mu[j * ns + i] = rho * sigma * v_[j] * S_[i] / (4.0 * dS * dv);
+			}
+		}
+	}
+
+	// A2 (direction v), identique pour tous les S
+	std::vector<double> a2(nv), b2(nv), c2(nv);
+	for (int j = 0; j < nv; ++j)
+	{
+		double gamma = 0.5 * sigma * sigma * v_[j] / (dv * dv);
+		double delta = 0.5 * kappa * (theta - v_[j]) / dv;
+		if (j == 0)
+		{
+			// v = 0 : seule la dérive kappa theta subsiste, décentrée vers l'intérieur
+			a2[j] = 0.0;
+			b2[j] = -kappa * theta / dv - 0.5 * r_;
+			c2[j] = kappa * theta / dv;
+		}
+		else if (j == nv - 1)
+		{
+			// v = vmax : V_v = 0 par réflexion du noeud fantôme
+			a2[j] = 2.0 * gamma;
+			b2[j] = -2.0 * gamma - 0.5 * r_;
+			c2[j] = 0.0;
+		}
+		else
+		{
+			a2[j] = gamma - delta;
+			b2[j] = -2.0 * gamma - 0.5 * r_;
+			c2[j] = gamma + delta;
+		}
+	}
+
+	// Factorisations uniques de (I - w A1) pour chaque ligne et de (I - w A2)
+	std::vector<double> l1(nv * n1), c1p(nv * n1), inv1(nv * n1), d(std::max(n1, nv)), u(std::max(n1, nv));
+	for (int j = 0; j < nv; ++j)
+	{
+		const int o = j * ns + 1;
+		matriceImplicite(n1, &a1[o], &b1[o], &c1[o], w, &l1[j * n1], d.data(), u.data());
+		thomasFactoriser(n1, &l1[j * n1], d.data(), u.data(), &c1p[j * n1], &inv1[j * n1]);
+	}
+	std::vector<double> l2(nv), c2p(nv), inv2(nv);
+	matriceImplicite(nv, a2.data(), b2.data(), c2.data(), w, l2.data(), d.data(), u.data());
+	thomasFactoriser(nv, l2.data(), d.data(), u.data(), c2p.data(), inv2.data());
+
+	// Couches courante et suivante, indicées [j * ns + i]
+	std::vector<double> U(nv * ns), W(nv * ns);
+	for (int j = 0; j < nv; ++j)
+	{
+		for (int i = 0; i < ns; ++i)
+		{
+			U[j * ns + i] = option_.payoff(S_[i]);
+		}
+	}
+
+	// Threads créés une fois pour toute la résolution : chacun traite une tranche fixe de lignes
+	// en v puis de colonnes en S à chaque pas, deux rendez-vous séparant les demi-pas
+	const int nt = std::max(1, std::min(nbThreads_, std::min(nv, n1)));
+	Rendezvous rendezvous(nt);
+	double *resultat = nullptr;
+
+	auto travailleur = [&](int k)
+	{
+		const int jDebut = nv * k / nt, jFin = nv * (k + 1) / nt;
+		const int iDebut = 1 + n1 * k / nt, iFin = 1 + n1 * (k + 1) / nt;
+		// Espace de travail du thread : A2 U sur une ligne et r' de Thomas
+		std::vector<double> travail(2 * ns);
+		double *A2U = travail.data();
+		double *r_prime = A2U + ns;
+		// Couches courante et suivante, échangées au même pas par tous les threads
+		double *Uc = U.data(), *Wc = W.data();
+
+		for (int m = M - 2; m >= 0; --m)
+		{
+			double g0 = option_.lowerBoundary(t_[m], r_);
+			double gN = option_.upperBoundary(S_[ns - 1], t_[m], r_);
+
+			// Prédicteur explicite et correction implicite en S, ligne de variance par ligne
+			for (int j = jDebut; j < jFin; ++j)
+			{
+				const double *Uj = Uc + j * ns;
+				const double *Up = j > 0 ? Uj - ns : Uj;	   // a2[0] = 0
+				const double *Us = j < nv - 1 ? Uj + ns : Uj; // c2[nv - 1] = 0
+				double *Wj = Wc + j * ns;
+				for (int i = 1; i < ns - 1; ++i)
+				{
+					int o = j * ns + i;
+					double A1U = a1[o] * Uj[i - 1] + b1[o] * Uj[i] + c1[o] * Uj[i + 1];
+					A2U[i] = a2[j] * Up[i] + b2[j] * Uj[i] + c2[j] * Us[i];
+					double A0U = mu[o] * (Us[i + 1] - Us[i - 1] - Up[i + 1] + Up[i - 1]);
+					double Y0 = Uj[i] + dt * (A0U + A1U + A2U[i]);
+					Wj[i] = Y0 - w * A1U;
+				}
+				Wj[1] += w * a1[j * ns + 1] * g0;
+				Wj[ns - 2] += w * c1[j * ns + ns - 2] * gN;
+				thomasSubstituer(n1, &l1[j * n1], &c1p[j * n1], &inv1[j * n1], Wj + 1, Wj + 1, r_prime);
+				for (int i = 1; i < ns - 1; ++i)
+				{
+					Wj[i] -= w * A2U[i];
+				}
+				Wj[0] = g0;
+				Wj[ns - 1] = gN;
+			}
+			rendezvous.attendre();
+
+			// Correction implicite en v : colonnes résolues par lots contigus
+			thomasSubstituerLot(nv, iFin - iDebut, ns, l2.data(), c2p.data(), inv2.data(), Wc + iDebut);
+			rendezvous.attendre();
+
+			std::swap(Uc, Wc);
+		}
+		if (k == 0)
+		{
+			resultat = Uc;
+		}
+	};
+
+	std::vector<std::thread> threads;
+	threads.reserve(nt - 1);
+	for (int k = 1; k < nt; ++k)
+	{
+		threads.emplace_back(travailleur, k);
+	}
+	travailleur(0);
+	for (std::thread &th : threads)
+	{
+		th.join();
+	}
+
+	std::vector<std::vector<double>> V(nv);
+	for (int j = 0; j < nv; ++j)
+	{
+		V[j].assign(resultat + j * ns, resultat + (j + 1) * ns);
+	}
+	return V;
+}
+
+/**
+ * @brief Prix interpolé bilinéairement en (S, v) sur la couche renvoyée par solve
+ * @param V Prix à la date initiale, indicés [j][i]
+ * @param S Prix du sous-jacent
+ * @param v Variance instantanée
+ * @return Prix de l'option
+ */
+double Heston::prixEn(const std::vector<std::vector<double>> &V, double S, double v) const
+{
+	const int ns = (int)S_.size(), nv = (int)v_.size();
+	double dS = S_[1] - S_[0], dv = v_[1] - v_[0];
+	int i = std::min(std::max((int)((S - S_[0]) / dS), 0), ns - 2);
+	int j = std::min(std::max((int)((v - v_[0]) / dv), 0), nv - 2);
+	double x = (S - S_[i]) / dS, y = (v - v_[j]) / dv;
+	return (1.0 - y) * ((1.0 - x) * V[j][i] + x * V[j][i + 1]) + y * ((1.0 - x) * V[j + 1][i] + x * V[j + 1][i + 1]);
+}
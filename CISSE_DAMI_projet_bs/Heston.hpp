@@ -0,0 +1,93 @@
+/**
+ * @file Heston.hpp
+ * @brief Déclaration du solveur ADI (schéma de Douglas) de l'EDP de Heston à deux facteurs (S, v)
+ */
+
+#ifndef HESTON_HPP
+#define HESTON_HPP
+
+#include "Option.hpp"
+#include <vector>
+
+/**
+ * @struct ParametresHeston
+ * @brief Paramètres de la variance stochastique : dv = kappa (theta - v) dt + sigma sqrt(v) dW, corrélation rho avec S
+ */
+struct ParametresHeston
+{
+	double kappa; // Vitesse de retour à la moyenne
+	double theta; // Variance de long terme
+	double sigma; // Volatilité de la variance (vol-of-vol)
+	double rho;	  // Corrélation entre le sous-jacent et la variance
+};
+
+/**
+ * @class Heston
+ * @brief Résolution de l'EDP de Heston par le schéma ADI de Douglas
+ *
+ * V_tau = 1/2 v S^2 V_SS + rho sigma v S V_Sv + 1/2 sigma^2 v V_vv + r S V_S + kappa (theta - v) V_v - r V
+ *
+ * L'opérateur est découpé en A0 (dérivée croisée, explicite), A1 (direction S) et A2
+ * (direction v), le terme -rV étant partagé entre A1 et A2. Chaque pas de temps enchaîne
+ * un prédicteur explicite et deux corrections implicites (theta = 1/2) :
+ *
+ * Y0 = U + dt A U,  (I - dt/2 A1) Y1 = Y0 - dt/2 A1 U,  (I - dt/2 A2) U' = Y1 - dt/2 A2 U
+ *
+ * Les matrices étant constantes, elles sont factorisées une fois. Les lignes en S (une
+ * par niveau de variance) sont résolues par thomasSubstituer ; en v, la matrice est la même
+ * pour tous les S, et les colonnes sont résolues par lots contigus (thomasSubstituerLot).
+ * Les deux étapes sont réparties entre plusieurs threads.
+ *
+ * Bords : conditions de l'option (lowerBoundary, upperBoundary) en S = 0 et S = Smax ; en
+ * v = 0 l'EDP dégénérée est discrétisée par un schéma décentré ; en v = vmax, V_v = 0.
+ */
+class Heston
+{
+private:
+	const Option &option_;	  // Option à évaluer
+	double r_;				  // Taux d'intérêt sans risque
+	ParametresHeston p_;	  // Paramètres de la variance
+	std::vector<double> S_;	  // Grille uniforme des prix du sous-jacent, de 0 à Smax
+	std::vector<double> v_;	  // Grille uniforme des variances, de 0 à vmax
+	std::vector<double> t_;	  // Grille uniforme des temps
+	int nbThreads_;			  // Nombre de threads
+
+public:
+	/**
+	 * @brief Constructeur de la classe Heston
+	 * @param option Option à évaluer, doit survivre au solveur
+	 * @param actif Actif sous-jacent : seul le taux r_ est utilisé, la volatilité est donnée par la variance
+	 * @param p Paramètres de la variance
+	 * @param S Grille uniforme des prix du sous-jacent (au moins 3 points)
+	 * @param v Grille uniforme des variances, commençant en 0 (au moins 3 points)
+	 * @param t Grille uniforme des temps (au moins 2 points)
+	 * @param nbThreads Nombre de threads, 0 pour le nombre de coeurs disponibles
+	 * @throw std::invalid_argument si les grilles sont trop petites, si v ne commence pas en 0
+	 *        ou si l'actif a une volatilité locale, une courbe de taux ou des dividendes
+	 */
+	Heston(const Option &option, const Actif &actif, const ParametresHeston &p, const std::vector<double> &S,
+		   const std::vector<double> &v, const std::vector<double> &t, int nbThreads = 0);
+
+	/**
+	 * @brief Résout l'EDP de Heston de l'échéance jusqu'à la date initiale
+	 * @return Prix à la date initiale, indicés [j][i] pour la variance v_j et le prix S_i
+	 */
+	std::vector<std::vector<double>> solve() const;
+
+	/**
+	 * @brief Prix interpolé bilinéairement en (S, v) sur la couche renvoyée par solve
+	 * @param V Prix à la date initiale, indicés [j][i]
+	 * @param S Prix du sous-jacent
+	 * @param v Variance instantanée
+	 * @return Prix de l'option
+	 */
+	double prixEn(const std::vector<std::vector<double>> &V, double S, double v) const;
+
+	/**
+	 * @brief Récupérer le nombre de threads utilisés
+	 * @return Nombre de threads
+	 */
+	int getNbThreads() const { return nbThreads_; }
+};
+
+#endif
@@ -0,0 +1,189 @@
+/**
+ * @file Marche.cpp
+ * @brief Implémentation des classes CourbeTaux et VolLocale
+ */
+
+#include "Marche.hpp"
+#include <algorithm>
+#include <stdexcept>
+
+/**
+ * @brief Vérifie qu'une suite de piliers est non vide et strictement croissante
+ */
+static void verifierPiliers(const std::vector<double> &x, const char *message)
+{
+	if (x.empty())
+	{
+		throw std::invalid_argument(message);
+	}
+	for (size_t i = 1; i < x.size(); ++i)
+	{
+		if (!(x[i] > x[i - 1]))
+		{
+			throw std::invalid_argument(message);
+		}
+	}
+}
+
+/**
+ * @brief Position de x dans des piliers croissants : indice à gauche et poids du pilier à droite
+ */
+static void localiser(const std::vector<double> &piliers, double x, int &k, double &w)
+{
+	int n = piliers.size();
+	if (n == 1 || x <= piliers[0])
+	{
+		k = 0;
+		w = 0.0;
+		return;
+	}
+	if (x >= piliers[n - 1])
+	{
+		k = n - 1;
+		w = 0.0;
+		return;
+	}
+	k = std::upper_bound(piliers.begin(), piliers.end(), x) - piliers.begin() - 1;
+	w = (x - piliers[k]) / (piliers[k + 1] - piliers[k]);
+}
+
+/**
+ * @brief Constructeur de la classe CourbeTaux
+ */
+CourbeTaux::CourbeTaux(const std::vector<double> &t, const std::vector<double> &r) : t_(t), r_(r)
+{
+	verifierPiliers(t_, "CourbeTaux : les dates doivent être non vides et strictement croissantes");
+	if (r_.size() != t_.size())
+	{
+		throw std::invalid_argument("CourbeTaux : autant de taux que de dates sont attendus");
+	}
+}
+
+/**
+ * @brief Taux instantané
+ */
+double CourbeTaux::taux(double t) const
+{
+	int k;
+	double w;
+	localiser(t_, t, k, w);
+	return w == 0.0 ? r_[k] : (1.0 - w) * r_[k] + w * r_[k + 1];
+}
+
+/**
+ * @brief Taux moyen entre deux dates
+ *
+ * Intégrale exacte de l'interpolation linéaire par morceaux (méthode des trapèzes sur
+ * les piliers compris dans [t1, t2]).
+ */
+double CourbeTaux::tauxMoyen(double t1, double t2) const
+{
+	if (t2 - t1 <= 0.0)
+	{
+		return taux(t1);
+	}
+
+	double integrale = 0.0, a = t1, ra = taux(t1);
+	for (size_t i = 0; i < t_.size(); ++i)
+	{
+		if (t_[i] <= t1 || t_[i] >= t2)
+			continue;
+		integrale += 0.5 * (ra + r_[i]) * (t_[i] - a);
+		a = t_[i];
+		ra = r_[i];
+	}
+	integrale += 0.5 * (ra + taux(t2)) * (t2 - a);
+	return integrale / (t2 - t1);
+}
+
+/**
+ * @brief Constructeur de la classe VolLocale
+ */
+VolLocale::VolLocale(const std::vector<double> &S, const std::vector<double> &t, const std::vector<double> &sigma,
+					 bool lineaireEnTemps)
+	: S_(S), t_(t), sigma_(sigma), lineaireEnTemps_(lineaireEnTemps)
+{
+	verifierPiliers(S_, "VolLocale : les piliers en S doivent être non vides et strictement croissants");
+	verifierPiliers(t_, "VolLocale : les piliers en temps doivent être non vides et strictement croissants");
+	if (sigma_.size() != S_.size() * t_.size())
+	{
+		throw std::invalid_argument("VolLocale : t.size() * S.size() volatilités sont attendues");
+	}
+}
+
+/**
+ * @brief Volatilité locale en un point
+ */
+double VolLocale::sigma(double S, double t) const
+{
+	int k, l;
+	double wS, wt;
+	localiser(S_, S, k, wS);
+	positionTemps(t, l, wt);
+
+	int nS = S_.size();
+	int k1 = wS == 0.0 ? k : k + 1, l1 = wt == 0.0 ? l : l + 1;
+	double bas = (1.0 - wS) * sigma_[l * nS + k] + wS * sigma_[l * nS + k1];
+	double haut = (1.0 - wS) * sigma_[l1 * nS + k] + wS * sigma_[l1 * nS + k1];
+	return (1.0 - wt) * bas + wt * haut;
+}
+
+/**
+ * @brief Précalcule la position de chaque noeud d'une grille de calcul dans les piliers en S
+ */
+VolLocale::IndexS VolLocale::indexer(const double *S, int n) const
+{
+	IndexS index;
+	index.k.resize(n);
+	index.w.resize(n);
+	int dernier = S_.size() - 1;
+	for (int i = 0; i < n; ++i)
+	{
+		localiser(S_, S[i], index.k[i], index.w[i]);
+		// Le pilier de droite doit exister : au dernier pilier on se ramène à l'intervalle précédent
+		if (index.k[i] == dernier && dernier > 0)
+		{
+			index.k[i] = dernier - 1;
+			index.w[i] = 1.0;
+		}
+	}
+	return index;
+}
+
+/**
+ * @brief Position d'une date dans les piliers en temps
+ */
+void VolLocale::positionTemps(double t, int &l, double &w) const
+{
+	localiser(t_, t, l, w);
+	if (!lineaireEnTemps_)
+	{
+		w = 0.0;
+	}
+}
+
+/**
+ * @brief Carré de la volatilité sur toute une ligne de la grille de calcul, sans allocation
+ */
+void VolLocale::carreLigne(const IndexS &index, int l, double w, double *sig2) const
+{
+	int n = index.k.size(), nS = S_.size();
+	const double *bas = &sigma_[l * nS];
+	const double *haut = w == 0.0 ? bas : &sigma_[(l + 1) * nS];
+	const int *k = index.k.data();
+	const double *wS = index.w.data();
+
+	if (nS == 1)
+	{
+		double s = (1.0 - w) * bas[0] + w * haut[0];
+		std::fill(sig2, sig2 + n, s * s);
+		return;
+	}
+	for (int i = 0; i < n; ++i)
+	{
+		double sBas = bas[k[i]] + wS[i] * (bas[k[i] + 1] - bas[k[i]]);
+		double sHaut = haut[k[i]] + wS[i] * (haut[k[i] + 1] - haut[k[i]]);
+		double s = sBas + w * (sHaut - sBas);
+		sig2[i] = s * s;
+	}
+}
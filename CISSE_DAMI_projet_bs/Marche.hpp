@@ -0,0 +1,117 @@
+/**
+ * @file Marche.hpp
+ * @brief Déclaration des données de marché tabulées : courbe de taux r(t) et surface de volatilité locale sigma(S, t)
+ */
+
+#ifndef MARCHE_HPP
+#define MARCHE_HPP
+
+#include <vector>
+
+/**
+ * @class CourbeTaux
+ * @brief Structure par terme des taux sans risque r(t), interpolée linéairement entre les piliers
+ *
+ * En dehors des piliers, le taux est prolongé par une constante.
+ */
+class CourbeTaux
+{
+protected:
+	std::vector<double> t_; // Dates des piliers, croissantes
+	std::vector<double> r_; // Taux aux piliers
+public:
+	/**
+	 * @brief Constructeur de la classe CourbeTaux
+	 * @param t Dates des piliers, strictement croissantes
+	 * @param r Taux aux piliers
+	 * @throw std::invalid_argument si les tailles diffèrent, sont nulles ou si les dates ne sont pas croissantes
+	 */
+	CourbeTaux(const std::vector<double> &t, const std::vector<double> &r);
+
+	/**
+	 * @brief Taux instantané
+	 * @param t Temps
+	 * @return r(t)
+	 */
+	double taux(double t) const;
+
+	/**
+	 * @brief Taux moyen entre deux dates, (1 / (t2 - t1)) * intégrale de r sur [t1, t2]
+	 * @param t1 Date de début
+	 * @param t2 Date de fin
+	 * @return Taux constant équivalent (actualisation identique)
+	 */
+	double tauxMoyen(double t1, double t2) const;
+};
+
+/**
+ * @class VolLocale
+ * @brief Surface de volatilité locale sigma(S, t) tabulée sur une grille (S_k, t_l)
+ *
+ * Interpolation linéaire en S ; en temps, interpolation linéaire ou constante par morceaux
+ * (valeur du dernier pilier atteint). Prolongement par une constante en dehors de la grille.
+ */
+class VolLocale
+{
+protected:
+	std::vector<double> S_;		// Piliers en prix du sous-jacent, croissants
+	std::vector<double> t_;		// Piliers en temps, croissants
+	std::vector<double> sigma_; // Volatilités, rangées par temps : sigma_[l * S_.size() + k]
+	bool lineaireEnTemps_;		// Interpolation linéaire (true) ou constante par morceaux (false) en temps
+public:
+	/**
+	 * @struct IndexS
+	 * @brief Positions précalculées des noeuds d'une grille de calcul dans les piliers en S
+	 */
+	struct IndexS
+	{
+		std::vector<int> k;	   // Indice du pilier à gauche
+		std::vector<double> w; // Poids du pilier à droite
+	};
+
+	/**
+	 * @brief Constructeur de la classe VolLocale
+	 * @param S Piliers en prix, strictement croissants
+	 * @param t Piliers en temps, strictement croissants
+	 * @param sigma Volatilités (t.size() * S.size() valeurs, rangées par temps)
+	 * @param lineaireEnTemps Interpolation linéaire en temps (sinon constante par morceaux)
+	 * @throw std::invalid_argument si les dimensions sont incohérentes
+	 */
+	VolLocale(const std::vector<double> &S, const std::vector<double> &t, const std::vector<double> &sigma,
+			  bool lineaireEnTemps = true);
+
+	/**
+	 * @brief Volatilité locale en un point
+	 * @param S Prix du sous-jacent
+	 * @param t Temps
+	 * @return sigma(S, t)
+	 */
+	double sigma(double S, double t) const;
+
+	/**
+	 * @brief Précalcule la position de chaque noeud d'une grille de calcul dans les piliers en S
+	 * @param S Grille des prix
+	 * @param n Nombre de noeuds
+	 * @return Indices et poids d'interpolation
+	 */
+	IndexS indexer(const double *S, int n) const;
+
+	/**
+	 * @brief Position d'une date dans les piliers en temps
+	 * @param t Temps
+	 * @param l Indice du pilier à gauche
+	 * @param w Poids du pilier à droite (nul en interpolation constante par morceaux)
+	 */
+	void positionTemps(double t, int &l, double &w) const;
+
+	/**
+	 * @brief Carré de la volatilité sur toute une ligne de la grille de calcul, sans allocation
+	 * @param index Positions précalculées (indexer)
+	 * @param l Indice du pilier en temps (positionTemps)
+	 * @param w Poids du pilier suivant en temps (positionTemps)
+	 * @param sig2 Résultat : sigma^2 en chaque noeud (index.k.size() valeurs)
+	 */
+	void carreLigne(const IndexS &index, int l, double w, double *sig2) const;
+};
+
+#endif
@@ -0,0 +1,265 @@
+/**
+ * @file MonteCarlo.cpp
+ * @brief Implémentation du moteur de Monte-Carlo : lots de trajectoires en structure de tableaux, blocs réduits dans l'ordre
+ */
+
+#include "MonteCarlo.hpp"
+#include "Dimensionnement.hpp"
+#include "Philox.hpp"
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+namespace
+{
+
+const int TailleLot = 64;		// Échantillons simulés ensemble, en structure de tableaux
+const int LotsParBloc = 64;		// Lots par bloc de réduction
+const long TailleBloc = (long)TailleLot * LotsParBloc;
+
+/**
+ * @struct Sommes
+ * @brief Sommes d'un bloc d'échantillons (Y payoff actualisé, X contrôle européen actualisé)
+ */
+struct Sommes
+{
+	double y = 0.0, x = 0.0, yy = 0.0, xx = 0.0, xy = 0.0;
+	long n = 0;
+};
+
+/**
+ * @struct Lot
+ * @brief État de TailleLot trajectoires, un tableau par grandeur
+ */
+struct Lot
+{
+	double S[TailleLot], somme[TailleLot], mini[TailleLot], maxi[TailleLot];
+};
+
+/**
+ * @brief Payoff actualisé d'une trajectoire et de son contrôle européen
+ */
+inline void payoffs(const ContratTrajectoire &c, double K, double S, double somme, double mini, double maxi,
+					double actualisation, double &y, double &x)
+{
+	double p = 0.0;
+	switch (c.payoff)
+	{
+	case Payoff::Europeen:
+		p = c.call ? S - K : K - S;
+		break;
+	case Payoff::Asiatique:
+		p = c.call ? somme / c.nbDates - K : K - somme / c.nbDates;
+		break;
+	case Payoff::LookbackFixe:
+		p = c.call ? maxi - K : K - mini;
+		break;
+	case Payoff::LookbackFlottant:
+		p = c.call ? S - mini : maxi - S;
+		break;
+	}
+	y = actualisation * std::max(p, 0.0);
+	x = actualisation * std::max(c.call ? S - K : K - S, 0.0);
+}
+
+} // namespace
+
+/**
+ * @brief Constructeur de la classe MonteCarlo
+ * @param actif Actif sous-jacent, doit survivre au moteur
+ * @param graine Graine du générateur
+ * @param nbThreads Nombre de threads, 0 pour le nombre de coeurs disponibles
+ */
+MonteCarlo::MonteCarlo(const Actif &actif, uint64_t graine, int nbThreads)
+	: actif_(actif), graine_(graine), nbThreads_(nbThreads)
+{
+	if (actif_.estVariable() || !actif_.dividendes_.empty())
+	{
+		throw std::invalid_argument("MonteCarlo : volatilité locale, courbe de taux et dividendes non gérés");
+	}
+	if (!(actif_.S0_ > 0.0) || !(actif_.sigma_ > 0.0))
+	{
+		throw std::invalid_argument("MonteCarlo : S0 et sigma doivent être strictement positifs");
+	}
+	if (nbThreads_ <= 0)
+	{
+		nbThreads_ = std::max(1u, std::thread::hardware_concurrency());
+	}
+}
+
+/**
+ * @brief Estime le prix d'un contrat
+ * @param contrat Contrat à évaluer
+ * @param nbTrajectoires Nombre de trajectoires, antithétiques comprises
+ * @return Prix, erreur standard et paramètres du contrôle
+ */
+ResultatMonteCarlo MonteCarlo::evaluer(const ContratTrajectoire &contrat, long nbTrajectoires) const
+{
+	const bool flottant = contrat.payoff == Payoff::LookbackFlottant;
+	// Au moins deux échantillons pour la variance empirique, soit deux paires avec les antithétiques
+	if (!(contrat.T > 0.0) || contrat.nbDates < 1 || (!flottant && !(contrat.K > 0.0)) ||
+		nbTrajectoires < (antithetique_ ? 4 : 2))
+	{
+		throw std::invalid_argument("MonteCarlo : contrat incohérent ou trop peu de trajectoires");
+	}
+
+	// Un échantillon est une trajectoire, ou une paire antithétique moyennée
+	const long nbEchantillons = antithetique_ ? nbTrajectoires / 2 : nbTrajectoires;
+	const long nbBlocs = (nbEchantillons + TailleBloc - 1) / TailleBloc;
+	const int n = contrat.nbDates;
+	const double dt = contrat.T / n;
+	const double derive = (actif_.r_ - 0.5 * actif_.sigma_ * actif_.sigma_) * dt;
+	const double diffusion = actif_.sigma_ * std::sqrt(dt);
+	const double deriveDouble = std::exp(2.0 * derive); // exp(d + v Z) exp(d - v Z)
+	const double actualisation = std::exp(-actif_.r_ * contrat.T);
+	const double S0 = actif_.S0_;
+	const double K = flottant ? S0 : contrat.K; // Strike du contrôle européen
+	const bool anti = antithetique_;
+	const uint64_t graine = graine_;
+
+	// Simule les échantillons d'un bloc, lot par lot, et accumule leurs sommes
+	auto simulerBloc = [&](long bloc, Sommes &s)
+	{
+		Lot a, b;
+		uint32_t u[4 * TailleLot];
+		double z[4 * TailleLot], e[TailleLot];
+		long debutBloc = bloc * TailleBloc, finBloc = std::min(debutBloc + TailleBloc, nbEchantillons);
+		for (long debut = debutBloc; debut < finBloc; debut += TailleLot)
+		{
+			const int taille = (int)std::min((long)TailleLot, finBloc - debut);
+			for (int i = 0; i < TailleLot; ++i)
+			{
+				a.S[i] = b.S[i] = S0;
+				a.somme[i] = b.somme[i] = 0.0;
+				a.mini[i] = b.mini[i] = a.maxi[i] = b.maxi[i] = S0;
+			}
+			for (int k = 0; k < n; k += 4)
+			{
+				// Tirages Philox des pas k..k+3, rangés par pas : u[q * TailleLot + i]
+				for (int i = 0; i < TailleLot; ++i)
+				{
+					uint64_t id = (uint64_t)(debut + i);
+					uint32_t c[4] = {(uint32_t)(k / 4), 0u, (uint32_t)id, (uint32_t)(id >> 32)};
+					philox4x32(c, (uint32_t)graine, (uint32_t)(graine >> 32));
+					for (int q = 0; q < 4; ++q)
+						u[q * TailleLot + i] = c[q];
+				}
+				for (int i = 0; i < 2 * TailleLot; ++i)
+				{
+					boxMuller(u[i], u[2 * TailleLot + i], z[i], z[2 * TailleLot + i]);
+				}
+				const int pas = std::min(4, n - k);
+				for (int q = 0; q < pas; ++q)
+				{
+					const double *zq = z + q * TailleLot;
+					for (int i = 0; i < TailleLot; ++i)
+					{
+						e[i] = std::exp(derive + diffusion * zq[i]);
+					}
+					// Mises à jour sans appel ni branchement : vectorisées
+					for (int i = 0; i < TailleLot; ++i)
+					{
+						a.S[i] *= e[i];
+						a.somme[i] += a.S[i];
+						a.mini[i] = std::min(a.mini[i], a.S[i]);
+						a.maxi[i] = std::max(a.maxi[i], a.S[i]);
+					}
+					if (anti)
+					{
+						for (int i = 0; i < TailleLot; ++i)
+						{
+							b.S[i] *= deriveDouble / e[i];
+							b.somme[i] += b.S[i];
+							b.mini[i] = std::min(b.mini[i], b.S[i]);
+							b.maxi[i] = std::max(b.maxi[i], b.S[i]);
+						}
+					}
+				}
+			}
+			// Payoffs, dans l'ordre des échantillons
+			for (int i = 0; i < taille; ++i)
+			{
+				double y, x;
+				payoffs(contrat, K, a.S[i], a.somme[i], a.mini[i], a.maxi[i], actualisation, y, x);
+				if (anti)
+				{
+					double y2, x2;
+					payoffs(contrat, K, b.S[i], b.somme[i], b.mini[i], b.maxi[i], actualisation, y2, x2);
+					y = 0.5 * (y + y2);
+					x = 0.5 * (x + x2);
+				}
+				s.y += y;
+				s.x += x;
+				s.yy += y * y;
+				s.xx += x * x;
+				s.xy += x * y;
+			}
+			s.n += taille;
+		}
+	};
+
+	// Blocs distribués dynamiquement ; chaque bloc écrit ses propres sommes
+	std::vector<Sommes> sommes(nbBlocs);
+	std::atomic<long> suivant(0);
+	auto travailleur = [&]()
+	{
+		for (long bloc = suivant++; bloc < nbBlocs; bloc = suivant++)
+		{
+			simulerBloc(bloc, sommes[bloc]);
+		}
+	};
+	const int nt = (int)std::max(1L, std::min((long)nbThreads_, nbBlocs));
+	std::vector<std::thread> threads;
+	threads.reserve(nt - 1);
+	for (int k = 1; k < nt; ++k)
+	{
+		threads.emplace_back(travailleur);
+	}
+	travailleur();
+	for (std::thread &th : threads)
+	{
+		th.join();
+	}
+
+	// Réduction dans l'ordre des blocs : résultat indépendant du nombre de threads
+	Sommes total;
+	for (const Sommes &s : sommes)
+	{
+		total.y += s.y;
+		total.x += s.x;
+		total.yy += s.yy;
+		total.xx += s.xx;
+		total.xy += s.xy;
+		total.n += s.n;
+	}
+	const double N = (double)total.n;
+	const double moyY = total.y / N, moyX = total.x / N;
+	const double varY = std::max(total.yy / N - moyY * moyY, 0.0) * N / (N - 1.0);
+
+	ResultatMonteCarlo res;
+	res.trajectoires = anti ? 2 * total.n : total.n;
+	res.prix = moyY;
+	res.erreur = std::sqrt(varY / N);
+	res.beta = 0.0;
+	res.prixControle = 0.0;
+
+	// Variable de contrôle : beta = Cov(X, Y) / Var(X), espérance de X par différences finies
+	const double varX = std::max(total.xx / N - moyX * moyX, 0.0) * N / (N - 1.0);
+	if (controle_ && varX > 0.0)
+	{
+		const double covXY = (total.xy / N - moyX * moyY) * N / (N - 1.0);
+		Actif actif(actif_.S0_, actif_.r_, actif_.sigma_);
+		Call call(K, contrat.T);
+		Put put(K, contrat.T);
+		Option &option = contrat.call ? static_cast<Option &>(call) : static_cast<Option &>(put);
+		// Toute erreur sur E[X] passe telle quelle dans le prix : la grille vise 1e-6 S0, sous l'erreur statistique
+		res.prixControle = dimensionnerGrille(option, actif, 1e-6 * S0).valeur;
+		res.beta = covXY / varX;
+		res.prix = moyY - res.beta * (moyX - res.prixControle);
+		res.erreur = std::sqrt(std::max(varY - covXY * covXY / varX, 0.0) / N);
+	}
+	return res;
+}
@@ -0,0 +1,117 @@
+/**
+ * @file MonteCarlo.hpp
+ * @brief Déclaration du moteur de Monte-Carlo pour les payoffs dépendant de la trajectoire (asiatiques, lookback)
+ */
+
+#ifndef MONTECARLO_HPP
+#define MONTECARLO_HPP
+
+#include "Option.hpp"
+#include <cstdint>
+
+/**
+ * @brief Payoff évalué sur la trajectoire discrète S_0, S_1, ..., S_n aux dates d'observation
+ */
+enum class Payoff
+{
+	Europeen,		 // Call (S_n - K)+, put (K - S_n)+
+	Asiatique,		 // Moyenne arithmétique A de S_1..S_n : call (A - K)+, put (K - A)+
+	LookbackFixe,	 // Call (max S - K)+, put (K - min S)+
+	LookbackFlottant // Call S_n - min S, put max S - S_n (K ignoré)
+};
+
+/**
+ * @struct ContratTrajectoire
+ * @brief Contrat dépendant de la trajectoire, observé à nbDates dates équiréparties sur ]0, T]
+ */
+struct ContratTrajectoire
+{
+	Payoff payoff; // Forme du payoff
+	bool call;	   // Call (true) ou put (false)
+	double K;	   // Prix d'exercice
+	double T;	   // Maturité
+	int nbDates;   // Nombre de dates d'observation (pas de simulation)
+};
+
+/**
+ * @struct ResultatMonteCarlo
+ * @brief Prix estimé et précision de l'estimation
+ */
+struct ResultatMonteCarlo
+{
+	double prix;		 // Estimation du prix
+	double erreur;		 // Erreur standard de l'estimation
+	long trajectoires;	 // Nombre de trajectoires simulées, antithétiques comprises
+	double beta;		 // Coefficient de la variable de contrôle (0 sans contrôle)
+	double prixControle; // Prix du contrôle européen par différences finies (0 sans contrôle)
+};
+
+/**
+ * @class MonteCarlo
+ * @brief Monte-Carlo multithread sur le modèle de Black-Scholes de l'Actif, reproductible pour tout nombre de threads
+ *
+ * Les trajectoires sont simulées exactement en log (S_{k+1} = S_k exp((r - sigma^2/2) dt + sigma sqrt(dt) Z))
+ * par lots de trajectoires rangés en structure de tableaux : chaque pas de temps met à jour
+ * tout le lot dans des boucles sans branchement, que le compilateur vectorise. Les
+ * gaussiennes viennent d'un générateur à compteur (Philox4x32-10) indexé par (trajectoire,
+ * pas) : aucun état n'est partagé entre threads.
+ *
+ * Réduction de variance :
+ * - variables antithétiques : chaque tirage Z sert aussi en -Z, l'échantillon étant la moyenne de la paire ;
+ * - variable de contrôle : le payoff européen de même sens et de même strike (à la monnaie pour le
+ *   lookback flottant), dont l'espérance est le prix Crank-Nicholson de la grille dimensionnée
+ *   automatiquement (dimensionnerGrille), avec un coefficient beta estimé sur l'échantillon.
+ *
+ * Les échantillons sont regroupés en blocs de taille fixe, distribués dynamiquement aux
+ * threads ; les sommes de chaque bloc sont réduites dans l'ordre des blocs, si bien que le
+ * résultat ne dépend pas du nombre de threads, au bit près.
+ */
+class MonteCarlo
+{
+private:
+	const Actif &actif_;	  // Actif sous-jacent : S0, r et sigma constants
+	uint64_t graine_;		  // Graine du générateur
+	int nbThreads_;			  // Nombre de threads
+	bool antithetique_ = true; // Variables antithétiques
+	bool controle_ = true;	  // Variable de contrôle européenne
+
+public:
+	/**
+	 * @brief Constructeur de la classe MonteCarlo
+	 * @param actif Actif sous-jacent, doit survivre au moteur
+	 * @param graine Graine du générateur
+	 * @param nbThreads Nombre de threads, 0 pour le nombre de coeurs disponibles
+	 * @throw std::invalid_argument si l'actif a une volatilité locale, une courbe de taux ou des dividendes
+	 */
+	MonteCarlo(const Actif &actif, uint64_t graine = 0, int nbThreads = 0);
+
+	/**
+	 * @brief Estime le prix d'un contrat
+	 * @param contrat Contrat à évaluer
+	 * @param nbTrajectoires Nombre de trajectoires, antithétiques comprises
+	 * @return Prix, erreur standard et paramètres du contrôle
+	 * @throw std::invalid_argument si le contrat est incohérent ou s'il y a moins de deux échantillons
+	 *        (nbTrajectoires < 4 avec les antithétiques, < 2 sans)
+	 */
+	ResultatMonteCarlo evaluer(const ContratTrajectoire &contrat, long nbTrajectoires) const;
+
+	/**
+	 * @brief Active ou désactive les variables antithétiques (activées par défaut)
+	 * @param actif true pour les activer
+	 */
+	void setAntithetique(bool actif) { antithetique_ = actif; }
+
+	/**
+	 * @brief Active ou désactive la variable de contrôle européenne (activée par défaut)
+	 * @param actif true pour l'activer
+	 */
+	void setControle(bool actif) { controle_ = actif; }
+
+	/**
+	 * @brief Récupérer le nombre de threads utilisés
+	 * @return Nombre de threads
+	 */
+	int getNbThreads() const { return nbThreads_; }
+};
+
+#endif
@@ -0,0 +1,284 @@
+/**
+ * @file Operateur.hpp
+ * @brief Noyaux de l'opérateur spatial tridiagonal partagés par les schémas aux différences finies
+ *
+ * Sur les n noeuds internes d'une couche de prix, l'opérateur discrétisé s'écrit
+ * (L V)_i = a_i V_{i-1} + b_i V_i + c_i V_{i+1}. Les couches complètes V contiennent
+ * n + 2 valeurs (bords compris) ; les coefficients a, b, c sont indicés de 0 à n - 1.
+ * Les coefficients sont conservés dans le type d'accumulation Acc, les couches de prix
+ * dans le type de stockage Real.
+ */
+
+#ifndef OPERATEUR_HPP
+#define OPERATEUR_HPP
+
+#include <algorithm>
+#include <cmath>
+
+/**
+ * @brief Coefficients de l'opérateur de Black-Scholes sur une grille uniforme
+ * @param N Nombre de points de la grille (bords compris)
+ * @param S Grille des prix du sous-jacent (N)
+ * @param dS Pas d'espace
+ * @param sigma Volatilité
+ * @param r Taux d'intérêt sans risque
+ * @param a Coefficients sous-diagonaux (N - 2)
+ * @param b Coefficients diagonaux (N - 2)
+ * @param c Coefficients sur-diagonaux (N - 2)
+ */
+template <typename Real>
+void operateurBlackScholes(int N, const double *S, double dS, double sigma, double r, Real *a, Real *b, Real *c)
+{
+	double diffusion = 0.5 * sigma * sigma / (dS * dS);
+	double convection = 0.5 * r / dS;
+	for (int i = 1; i < N - 1; ++i)
+	{
+		double Si = S[i];
+		double alpha = diffusion * Si * Si;
+		double beta = convection * Si;
+		a[i - 1] = Real(alpha - beta);
+		b[i - 1] = Real(-2.0 * alpha - r);
+		c[i - 1] = Real(alpha + beta);
+	}
+}
+
+/**
+ * @brief Facteurs géométriques de l'opérateur de Black-Scholes, indépendants de sigma et r
+ * @param N Nombre de points de la grille (bords compris)
+ * @param S Grille des prix du sous-jacent (N)
+ * @param dS Pas d'espace
+ * @param diffusion Résultat : 0.5 S_i^2 / dS^2 sur les noeuds internes (N - 2)
+ * @param convection Résultat : 0.5 S_i / dS sur les noeuds internes (N - 2)
+ */
+inline void facteursBlackScholes(int N, const double *S, double dS, double *diffusion, double *convection)
+{
+	for (int i = 1; i < N - 1; ++i)
+	{
+		diffusion[i - 1] = 0.5 * S[i] * S[i] / (dS * dS);
+		convection[i - 1] = 0.5 * S[i] / dS;
+	}
+}
+
+/**
+ * @brief Coefficients de l'opérateur de Black-Scholes à volatilité locale, sans allocation
+ *
+ * Reconstruit a, b, c à partir des facteurs précalculés et de sigma^2 sur la ligne :
+ * une boucle sans branchement ni division, vectorisable.
+ *
+ * @param n Nombre de noeuds internes
+ * @param diffusion, convection Facteurs précalculés (facteursBlackScholes)
+ * @param sig2 Carré de la volatilité sur les noeuds internes (n)
+ * @param r Taux d'intérêt instantané
+ * @param a, b, c Coefficients de l'opérateur (n)
+ */
+template <typename Real>
+void operateurLocal(int n, const double *diffusion, const double *convection, const double *sig2, double r,
+					Real *a, Real *b, Real *c)
+{
+	for (int i = 0; i < n; ++i)
+	{
+		double alpha = diffusion[i] * sig2[i];
+		double beta = convection[i] * r;
+		a[i] = Real(alpha - beta);
+		b[i] = Real(-2.0 * alpha - r);
+		c[i] = Real(alpha + beta);
+	}
+}
+
+/**
+ * @brief Coefficients de l'opérateur forward de Dupire en strike, sans allocation
+ *
+ * dC/dT = 1/2 sigma^2(K, T) K^2 C_KK - r(T) K C_K : même diffusion que Black-Scholes en S,
+ * convection de signe opposé et pas de terme d'actualisation (dividende continu nul).
+ *
+ * @param n Nombre de noeuds internes
+ * @param diffusion, convection Facteurs précalculés sur la grille des strikes (facteursBlackScholes)
+ * @param sig2 Carré de la volatilité locale sur les noeuds internes (n)
+ * @param r Taux d'intérêt instantané à la maturité T
+ * @param a, b, c Coefficients de l'opérateur (n)
+ */
+template <typename Real>
+void operateurDupire(int n, const double *diffusion, const double *convection, const double *sig2, double r,
+					 Real *a, Real *b, Real *c)
+{
+	for (int i = 0; i < n; ++i)
+	{
+		double alpha = diffusion[i] * sig2[i];
+		double beta = convection[i] * r;
+		a[i] = Real(alpha + beta);
+		b[i] = Real(-2.0 * alpha);
+		c[i] = Real(alpha - beta);
+	}
+}
+
+/**
+ * @brief Matrice tridiagonale (I - w L) du système implicite
+ * @param n Nombre de noeuds internes
+ * @param a, b, c Coefficients de l'opérateur (n)
+ * @param w Poids implicite (theta * dt pour le theta-schéma)
+ * @param l Coefficients sous-diagonaux (n - 1)
+ * @param d Coefficients diagonaux (n)
+ * @param u Coefficients sur-diagonaux (n - 1)
+ */
+template <typename Real>
+void matriceImplicite(int n, const Real *a, const Real *b, const Real *c, double w, Real *l, Real *d, Real *u)
+{
+	for (int i = 0; i < n; ++i)
+	{
+		d[i] = Real(1.0 - w * b[i]);
+	}
+	for (int i = 0; i < n - 1; ++i)
+	{
+		l[i] = Real(-w * a[i + 1]);
+		u[i] = Real(-w * c[i]);
+	}
+}
+
+/**
+ * @brief Partie explicite : out_i = V_i + w (L V)_i sur les noeuds internes
+ * @param n Nombre de noeuds internes
+ * @param a, b, c Coefficients de l'opérateur (n)
+ * @param w Poids explicite ((1 - theta) * dt pour le theta-schéma)
+ * @param V Couche complète (n + 2 valeurs, bords compris)
+ * @param out Résultat sur les noeuds internes (n)
+ */
+template <typename Real, typename Acc>
+void appliquerOperateur(int n, const Acc *a, const Acc *b, const Acc *c, Acc w, const Real *V, Real *out)
+{
+	if (w == Acc(0))
+	{
+		for (int i = 0; i < n; ++i)
+			out[i] = V[i + 1];
+		return;
+	}
+	for (int i = 0; i < n; ++i)
+	{
+		Acc LV = a[i] * Acc(V[i]) + b[i] * Acc(V[i + 1]) + c[i] * Acc(V[i + 2]);
+		out[i] = Real(Acc(V[i + 1]) + w * LV);
+	}
+}
+
+/**
+ * @brief Résolution de (I - w L) x = rhs en une seule passe de Thomas, sans former la matrice
+ *
+ * Utilisée quand l'opérateur change à chaque pas de temps : la construction de la matrice,
+ * la factorisation et la descente sont fusionnées, ce qui évite trois passes sur la mémoire.
+ *
+ * @param n Nombre de noeuds internes
+ * @param a, b, c Coefficients de l'opérateur (n)
+ * @param w Poids implicite
+ * @param rhs Second membre (n)
+ * @param x Solution (n), peut être confondu avec rhs
+ * @param c_prime Espace de travail (n)
+ * @param r_prime Espace de travail (n)
+ */
+template <typename Real, typename Acc>
+void resoudreImplicite(int n, const Acc *a, const Acc *b, const Acc *c, Acc w, const Real *rhs, Real *x,
+					   Acc *c_prime, Acc *r_prime)
+{
+	// Forward elimination
+	Acc inv = Acc(1) / (Acc(1) - w * b[0]);
+	c_prime[0] = -w * c[0] * inv;
+	r_prime[0] = Acc(rhs[0]) * inv;
+	for (int i = 1; i < n; ++i)
+	{
+		Acc li = -w * a[i];
+		inv = Acc(1) / (Acc(1) - w * b[i] - li * c_prime[i - 1]);
+		c_prime[i] = -w * c[i] * inv;
+		r_prime[i] = (Acc(rhs[i]) - li * r_prime[i - 1]) * inv;
+	}
+
+	// Back substitution
+	Acc suivant = r_prime[n - 1];
+	x[n - 1] = Real(suivant);
+	for (int i = n - 2; i >= 0; --i)
+	{
+		suivant = r_prime[i] - c_prime[i] * suivant;
+		x[i] = Real(suivant);
+	}
+}
+
+/**
+ * @brief Injection dans le second membre des valeurs aux bords connues au nouveau pas de temps
+ * @param n Nombre de noeuds internes
+ * @param a, c Coefficients de l'opérateur (n)
+ * @param w Poids implicite
+ * @param V Nouvelle couche complète dont les bords sont déjà fixés (n + 2 valeurs)
+ * @param rhs Second membre (n)
+ */
+template <typename Real, typename Acc>
+void injecterBords(int n, const Acc *a, const Acc *c, Acc w, const Real *V, Real *rhs)
+{
+	rhs[0] = Real(Acc(rhs[0]) + w * a[0] * Acc(V[0]));
+	rhs[n - 1] = Real(Acc(rhs[n - 1]) + w * c[n - 1] * Acc(V[n + 1]));
+}
+
+/**
+ * @brief Saut de dividende sur une couche complète de grille uniforme : V(S) <- V(S - D)
+ *
+ * Sur une grille uniforme, S_j - D tombe toujours à la même fraction de maille : la passe
+ * se réduit à une interpolation linéaire à poids constants, en place (de droite à gauche).
+ * En dessous du premier noeud, on prend la valeur au bord inférieur.
+ *
+ * @param N Nombre de points de la couche (bords compris)
+ * @param dS Pas d'espace
+ * @param D Montant du dividende, positif
+ * @param V Couche de prix (N)
+ */
+template <typename Real>
+void sauterDividende(int N, double dS, double D, Real *V)
+{
+	int k = (int)(D / dS);
+	Real f = Real(D / dS - k);
+	for (int j = N - 1; j > k; --j)
+	{
+		V[j] = (Real(1) - f) * V[j - k] + f * V[j - k - 1];
+	}
+	for (int j = std::min(k, N - 1); j > 0; --j)
+	{
+		V[j] = V[0];
+	}
+}
+
+/**
+ * @brief Écart maximal entre deux couches de prix, calculé en double
+ * @param N Nombre de points des couches
+ * @param V, W Couches de prix (N)
+ * @return max_j |V_j - W_j|
+ */
+template <typename Real>
+double ecartCouches(int N, const Real *V, const Real *W)
+{
+	double ecart = 0.0;
+	for (int j = 0; j < N; ++j)
+	{
+		ecart = std::max(ecart, std::abs(double(V[j]) - double(W[j])));
+	}
+	return ecart;
+}
+
+/**
+ * @brief Teste si deux couches de prix diffèrent de moins que la tolérance en tout point
+ *
+ * Le parcours s'interrompt au premier écart trop grand : tant que la solution évolue,
+ * le test ne coûte que quelques comparaisons.
+ *
+ * @param N Nombre de points des couches
+ * @param V, W Couches de prix (N)
+ * @param tolerance Écart maximal toléré
+ * @return true si max_j |V_j - W_j| < tolerance
+ */
+template <typename Real>
+bool couchesProches(int N, const Real *V, const Real *W, double tolerance)
+{
+	for (int j = 0; j < N; ++j)
+	{
+		if (!(std::abs(double(V[j]) - double(W[j])) < tolerance))
+		{
+			return false;
+		}
+	}
+	return true;
+}
+
+#endif
@@ -1,10 +1,11 @@
 /**
  * @file Option.cpp
- * @brief Implémentation des classes dérivées de Option : Call et Put
+ * @brief Implémentation des classes dérivées de Option : Call, Put et OptionBarriere
  */
 
 #include "Option.hpp"
 #include <cmath>
+#include <stdexcept>
 
 /**
  * @brief Calcule le payoff de l'option d'achat
@@ -26,7 +27,7 @@ double Call::payoff(double S) const
  * @param r Taux d'intérêt sans risque
  * @return Valeur de la condition de frontière inférieure
  */
-double Call::lowerBoundary(double t, double r) const
+double Call::lowerBoundary(double /*t*/, double /*r*/) const
 {
 	return 0.0;
 }
@@ -75,7 +76,67 @@ double Put::lowerBoundary(double t, double r) const
  * @param r Taux d'intérêt sans risque
  * @return Valeur de la condition de frontière supérieure
  */
-double Put::upperBoundary(double S_max, double t, double r) const
+double Put::upperBoundary(double /*S_max*/, double /*t*/, double /*r*/) const
 {
 	return 0;
-}
\ No newline at end of file
+}
+
+/**
+ * @brief Constructeur de la classe OptionBarriere
+ * @param vanille Option vanille (Call ou Put) portée par la barrière
+ * @param type Barrière haute ou basse
+ * @param B Niveau de la barrière, strictement positif
+ */
+OptionBarriere::OptionBarriere(const Option &vanille, Barriere type, double B)
+	: Option(vanille.getK(), vanille.getT()), vanille_(vanille), type_(type), B_(B)
+{
+	if (!(B > 0.0))
+	{
+		throw std::invalid_argument("OptionBarriere : la barrière doit être strictement positive");
+	}
+}
+
+/**
+ * @brief Calcule le payoff de l'option désactivante
+ * @param S Prix du sous-jacent à l'échéance
+ * @return Payoff de l'option vanille, ou 0 si la barrière est touchée
+ */
+double OptionBarriere::payoff(double S) const
+{
+	if (estTouchee(S))
+	{
+		return 0.0;
+	}
+	return vanille_.payoff(S);
+}
+
+/**
+ * @brief Condition de frontière inférieure : 0 sur une barrière basse, celle de la vanille sinon
+ * @param t Temps actuel
+ * @param r Taux d'intérêt sans risque
+ * @return Valeur de la condition de frontière inférieure
+ */
+double OptionBarriere::lowerBoundary(double t, double r) const
+{
+	if (type_ == Barriere::Basse)
+	{
+		return 0.0;
+	}
+	return vanille_.lowerBoundary(t, r);
+}
+
+/**
+ * @brief Condition de frontière supérieure : 0 sur une barrière haute, celle de la vanille sinon
+ * @param S_max Prix maximum du sous-jacent
+ * @param t Temps actuel
+ * @param r Taux d'intérêt sans risque
+ * @return Valeur de la condition de frontière supérieure
+ */
+double OptionBarriere::upperBoundary(double S_max, double t, double r) const
+{
+	if (type_ == Barriere::Haute)
+	{
+		return 0.0;
+	}
+	return vanille_.upperBoundary(S_max, t, r);
+}
@@ -1,11 +1,15 @@
 /**
  * @file Option.hpp
- * @brief Declartation de la classe abstraite Option et ses classes dérivées concrètes Call et Put
+ * @brief Declartation de la classe abstraite Option et ses classes dérivées concrètes Call, Put et OptionBarriere
  */
 
 #ifndef OPTION_HPP
 #define OPTION_HPP
 
+#include "Marche.hpp"
+#include <memory>
+#include <vector>
+
 /**
  * @class Option
  * @brief Classe abstraite représentant une option financière
@@ -145,6 +149,100 @@ public:
 	double upperBoundary(double S_max, double t, double r) const override;
 };
 
+/**
+ * @brief Position de la barrière par rapport au sous-jacent
+ */
+enum class Barriere
+{
+	Haute, // Désactivée si le sous-jacent monte jusqu'à la barrière (up-and-out)
+	Basse  // Désactivée si le sous-jacent descend jusqu'à la barrière (down-and-out)
+};
+
+/**
+ * @class OptionBarriere
+ * @brief Option désactivante : l'option vanille sous-jacente s'éteint (sans remise) dès que la barrière est touchée
+ *
+ * Le domaine de calcul est tronqué à la barrière, où la valeur est nulle : la grille
+ * doit avoir un noeud extrême sur la barrière (voir grilleBarriere). L'option activante
+ * correspondante s'obtient par parité, activante = vanille - désactivante (voir pariteActivante).
+ */
+class OptionBarriere : public Option
+{
+private:
+	const Option &vanille_; // Option vanille désactivée par la barrière, doit survivre à l'objet
+	Barriere type_;			// Position de la barrière
+	double B_;				// Niveau de la barrière
+
+public:
+	/**
+	 * @brief Constructeur de la classe OptionBarriere
+	 * @param vanille Option vanille (Call ou Put) portée par la barrière
+	 * @param type Barrière haute ou basse
+	 * @param B Niveau de la barrière, strictement positif
+	 * @throw std::invalid_argument si B n'est pas strictement positif
+	 */
+	OptionBarriere(const Option &vanille, Barriere type, double B);
+
+	/**
+	 * @brief Calcule le payoff de l'option désactivante
+	 * @param S Prix du sous-jacent à l'échéance
+	 * @return Payoff de l'option vanille, ou 0 si la barrière est touchée
+	 */
+	double payoff(double S) const override;
+
+	/**
+	 * @brief Condition de frontière inférieure : 0 sur une barrière basse, celle de la vanille sinon
+	 * @param t Temps actuel
+	 * @param r Taux d'intérêt sans risque
+	 * @return Valeur de la condition de frontière inférieure
+	 */
+	double lowerBoundary(double t, double r) const override;
+
+	/**
+	 * @brief Condition de frontière supérieure : 0 sur une barrière haute, celle de la vanille sinon
+	 * @param S_max Prix maximum du sous-jacent
+	 * @param t Temps actuel
+	 * @param r Taux d'intérêt sans risque
+	 * @return Valeur de la condition de frontière supérieure
+	 */
+	double upperBoundary(double S_max, double t, double r) const override;
+
+	/**
+	 * @brief Indique si un prix du sous-jacent est au-delà de la barrière (barrière comprise)
+	 * @param S Prix du sous-jacent
+	 * @return true si l'option est désactivée en S
+	 */
+	bool estTouchee(double S) const { return type_ == Barriere::Haute ? S >= B_ : S <= B_; }
+
+	/**
+	 * @brief getteur pour l'option vanille
+	 * @return Option vanille portée par la barrière
+	 */
+	const Option &getVanille() const { return vanille_; }
+
+	/**
+	 * @brief getteur pour la position de la barrière
+	 * @return Barrière haute ou basse
+	 */
+	Barriere getType() const { return type_; }
+
+	/**
+	 * @brief getteur pour le niveau de la barrière
+	 * @return Niveau de la barrière
+	 */
+	double getBarriere() const { return B_; }
+};
+
+/**
+ * @struct Dividende
+ * @brief Dividende discret en numéraire : à la date t_, le sous-jacent chute du montant versé
+ */
+struct Dividende
+{
+	double t_;		 // Date de détachement
+	double montant_; // Montant versé
+};
+
 /**
  * @struct Actif
  * @brief Structure représentant les paramètres d'un actif sous-jacent
@@ -156,6 +254,16 @@ struct Actif
 	double r_ = 0.1;	 // Taux d'intérêt sans risque
 	double sigma_ = 0.1; // Volatilité de l'actif sous-jacent
 
+	std::shared_ptr<const VolLocale> volLocale_;   // Volatilité locale sigma(S, t), remplace sigma_ si renseignée
+	std::shared_ptr<const CourbeTaux> courbeTaux_; // Courbe de taux r(t), remplace r_ si renseignée
+	std::vector<Dividende> dividendes_;			   // Dividendes discrets versés avant l'échéance
+
+	/**
+	 * @brief Indique si les paramètres dépendent de S ou de t
+	 * @return true si une volatilité locale ou une courbe de taux est renseignée
+	 */
+	bool estVariable() const { return volLocale_ || courbeTaux_; }
+
 	/**
 	 * @brief Constructeur de la structure Actif
 	 * @param S0_ Prix initial de l'actif sous-jacent
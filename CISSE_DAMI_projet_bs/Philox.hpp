@@ -0,0 +1,64 @@
+/**
+ * @file Philox.hpp
+ * @brief Générateur à compteur Philox4x32-10 et transformation de Box-Muller, sans état
+ */
+
+#ifndef PHILOX_HPP
+#define PHILOX_HPP
+
+#include <cmath>
+#include <cstdint>
+
+/**
+ * @brief Philox4x32-10 (Salmon et al., 2011) : quatre entiers de 32 bits, fonction pure du compteur et de la clé
+ *
+ * Sans état partagé, le tirage numéro (trajectoire, pas) est le même quel que soit le thread
+ * qui le calcule et l'ordre des calculs : c'est ce qui rend les simulations reproductibles
+ * pour tout nombre de threads. Les opérations (produits 32 x 32 -> 64 bits, ou exclusifs)
+ * se vectorisent quand la fonction est appelée dans une boucle sans autre appel.
+ *
+ * @param c Compteur (4 mots), remplacé par le résultat
+ * @param k0, k1 Clé (graine)
+ */
+inline void philox4x32(uint32_t c[4], uint32_t k0, uint32_t k1)
+{
+	const uint32_t M0 = 0xD2511F53u, M1 = 0xCD9E8D57u;
+	const uint32_t W0 = 0x9E3779B9u, W1 = 0xBB67AE85u;
+	for (int tour = 0; tour < 10; ++tour)
+	{
+		uint64_t p0 = (uint64_t)M0 * c[0];
+		uint64_t p1 = (uint64_t)M1 * c[2];
+		uint32_t h0 = (uint32_t)(p0 >> 32), l0 = (uint32_t)p0;
+		uint32_t h1 = (uint32_t)(p1 >> 32), l1 = (uint32_t)p1;
+		uint32_t n0 = h1 ^ c[1] ^ k0, n2 = h0 ^ c[3] ^ k1;
+		c[0] = n0;
+		c[1] = l1;
+		c[2] = n2;
+		c[3] = l0;
+		k0 += W0;
+		k1 += W1;
+	}
+}
+
+/**
+ * @brief Uniforme dans ]0, 1] à partir d'un entier de 32 bits
+ */
+inline double uniformePhilox(uint32_t x)
+{
+	return (x + 1.0) * (1.0 / 4294967296.0);
+}
+
+/**
+ * @brief Deux gaussiennes centrées réduites par Box-Muller, à partir de deux entiers de 32 bits
+ * @param u0, u1 Entiers uniformes
+ * @param z0, z1 Gaussiennes indépendantes
+ */
+inline void boxMuller(uint32_t u0, uint32_t u1, double &z0, double &z1)
+{
+	const double deuxPi = 6.283185307179586;
+	double rayon = std::sqrt(-2.0 * std::log(uniformePhilox(u0))), angle = deuxPi * uniformePhilox(u1);
+	z0 = rayon * std::cos(angle);
+	z1 = rayon * std::sin(angle);
+}
+
+#endif
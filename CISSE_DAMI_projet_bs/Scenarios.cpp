@@ -0,0 +1,79 @@
+/**
+ * @file Scenarios.cpp
+ * @brief Implémentation du moteur de scénarios
+ */
+
+#include "Scenarios.hpp"
+#include "DifferenceFinie.hpp"
+#include <algorithm>
+#include <stdexcept>
+#include <vector>
+
+/**
+ * @brief Constructeur de la classe MoteurScenarios
+ * @param option Option à évaluer, doit survivre au moteur
+ * @param actif Actif de base ; sigma_ et r_ sont fixés par les scénarios
+ * @param S Grille uniforme des prix du sous-jacent
+ * @param t Grille des temps
+ */
+MoteurScenarios::MoteurScenarios(Option &option, const Actif &actif, const std::vector<double> &S,
+								 const std::vector<double> &t)
+	: option_(option), actif_(actif), S_(S), t_(t)
+{
+}
+
+/**
+ * @brief Évalue l'option sous chaque scénario
+ * @param scenarios Scénarios de marché, dont les spots doivent être dans la grille
+ * @return Prix, dans l'ordre des scénarios
+ */
+std::vector<double> MoteurScenarios::evaluer(const std::vector<Scenario> &scenarios)
+{
+	const int n = (int)S_.size();
+	const double S0 = S_[0], dS = S_[1] - S_[0];
+	for (const Scenario &sc : scenarios)
+	{
+		if (sc.S < S0 || sc.S > S_[n - 1])
+		{
+			throw std::invalid_argument("MoteurScenarios : spot hors de la grille");
+		}
+	}
+
+	// Regroupement des scénarios par couple (sigma, r)
+	std::vector<int> ordre(scenarios.size());
+	for (size_t k = 0; k < ordre.size(); ++k)
+		ordre[k] = (int)k;
+	std::sort(ordre.begin(), ordre.end(), [&](int a, int b)
+			  { return scenarios[a].sigma < scenarios[b].sigma ||
+					   (scenarios[a].sigma == scenarios[b].sigma && scenarios[a].r < scenarios[b].r); });
+
+	// Grilles et schéma construits une fois ; le schéma lit sigma_ et r_ dans actif_ à chaque résolution
+	EDPComplete edp(option_, actif_);
+	Crank_Nicholson schema(edp, n, (int)t_.size(), S_, t_);
+
+	std::vector<double> prix(scenarios.size());
+	nbResolutions_ = 0;
+	for (size_t debut = 0; debut < ordre.size();)
+	{
+		const Scenario &ref = scenarios[ordre[debut]];
+		size_t fin = debut;
+		while (fin < ordre.size() && scenarios[ordre[fin]].sigma == ref.sigma && scenarios[ordre[fin]].r == ref.r)
+			++fin;
+
+		actif_.sigma_ = ref.sigma;
+		actif_.r_ = ref.r;
+		std::vector<double> V = schema.solveInitiale();
+		++nbResolutions_;
+
+		// Chocs de spot : interpolation linéaire sur la couche à la date initiale
+		for (size_t k = debut; k < fin; ++k)
+		{
+			double S = scenarios[ordre[k]].S;
+			int j = std::min((int)((S - S0) / dS), n - 2);
+			double w = (S - S_[j]) / dS;
+			prix[ordre[k]] = (1.0 - w) * V[j] + w * V[j + 1];
+		}
+		debut = fin;
+	}
+	return prix;
+}
@@ -0,0 +1,68 @@
+/**
+ * @file Scenarios.hpp
+ * @brief Déclaration du moteur de scénarios : une résolution par couple (sigma, r), chocs de spot lus sur la grille
+ */
+
+#ifndef SCENARIOS_HPP
+#define SCENARIOS_HPP
+
+#include "EDP.hpp"
+#include <vector>
+
+/**
+ * @struct Scenario
+ * @brief Marché choqué : prix du sous-jacent, volatilité et taux
+ */
+struct Scenario
+{
+	double S;	  // Prix du sous-jacent
+	double sigma; // Volatilité
+	double r;	  // Taux d'intérêt sans risque
+};
+
+/**
+ * @class MoteurScenarios
+ * @brief Évalue une option sous un ensemble de scénarios de marché en partageant les résolutions
+ *
+ * Un choc de spot ne demande pas de nouvelle résolution : c'est un autre point S de la
+ * couche V(., 0) déjà calculée. Les scénarios sont donc regroupés par couple (sigma, r) ;
+ * chaque couple distinct donne une seule résolution de Crank-Nicholson à deux couches
+ * (solveInitiale), sur des grilles et un schéma construits une fois pour tout le lot,
+ * et tous les spots du groupe sont interpolés linéairement sur la couche obtenue.
+ */
+class MoteurScenarios
+{
+private:
+	Option &option_;		// Option à évaluer
+	Actif actif_;			// Actif de base, dont sigma_ et r_ sont remplacés par ceux de chaque scénario
+	std::vector<double> S_; // Grille uniforme des prix du sous-jacent
+	std::vector<double> t_; // Grille des temps
+	int nbResolutions_ = 0; // Nombre de résolutions lors du dernier appel à evaluer
+
+public:
+	/**
+	 * @brief Constructeur de la classe MoteurScenarios
+	 * @param option Option à évaluer, doit survivre au moteur
+	 * @param actif Actif de base (dividendes) ; sigma_ et r_ sont fixés par les scénarios, sans effet
+	 *        si une volatilité locale ou une courbe de taux est renseignée
+	 * @param S Grille uniforme des prix du sous-jacent
+	 * @param t Grille des temps
+	 */
+	MoteurScenarios(Option &option, const Actif &actif, const std::vector<double> &S, const std::vector<double> &t);
+
+	/**
+	 * @brief Évalue l'option sous chaque scénario
+	 * @param scenarios Scénarios de marché, dont les spots doivent être dans la grille
+	 * @return Prix, dans l'ordre des scénarios
+	 * @throw std::invalid_argument si un spot est hors de la grille
+	 */
+	std::vector<double> evaluer(const std::vector<Scenario> &scenarios);
+
+	/**
+	 * @brief Nombre de résolutions effectuées lors du dernier appel à evaluer
+	 * @return Nombre de couples (sigma, r) distincts
+	 */
+	int getNbResolutions() const { return nbResolutions_; }
+};
+
+#endif
@@ -0,0 +1,374 @@
+/**
+ * @file ThetaSchema.cpp
+ * @brief Implémentation du theta-schéma, moteur commun de Crank_Nicholson et Implicite
+ */
+
+#include "DifferenceFinie.hpp"
+#include "Operateur.hpp"
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+/**
+ * @brief Resoution d'un système tridiagonal par la méthode de Thomas
+ * @param l Vecteur des coefficients sous-diagonaux
+ * @param d Vecteur des coefficients diagonaux
+ * @param u Vecteur des coefficients sur-diagonaux
+ * @param r Vecteur second membre
+ * @return Vecteur solution du système tridiagonal
+ */
+std::vector<double> ThomasAlgo(const std::vector<double> &l, const std::vector<double> &d, const std::vector<double> &u, const std::vector<double> &r)
+{
+	int n = r.size();				// Taille du système
+	std::vector<double> c_prime(n); // Vecteur des coefficients modifiés sur-diagonaux
+	std::vector<double> r_prime(n); // Vecteur des second membres modifiés
+	std::vector<double> x(n);
+
+	thomasResoudre(n, l.data(), d.data(), u.data(), r.data(), x.data(), c_prime.data(), r_prime.data());
+	return x;
+}
+
+/**
+ * @brief Résout l'EDP en utilisant le theta-schéma
+ * @return Matrice des prix de l'option aux différents points de la grille
+ */
+std::vector<std::vector<double>> ThetaSchema::solve()
+{
+	return solveAs<double>();
+}
+
+/**
+ * @brief Identifie les coefficients de l'opérateur à une date : tranche et poids de la volatilité locale, taux
+ *
+ * Deux dates de même clé ont le même opérateur, qui n'est alors ni reconstruit ni refactorisé.
+ */
+struct CleOperateur
+{
+	int l;	  // Pilier en temps de la volatilité locale
+	double w; // Poids du pilier suivant
+	double r; // Taux instantané
+
+	bool operator==(const CleOperateur &autre) const { return l == autre.l && w == autre.w && r == autre.r; }
+	bool operator!=(const CleOperateur &autre) const { return !(*this == autre); }
+};
+
+/**
+ * @brief Moteur du theta-schéma, dans le type scalaire choisi
+ *
+ * Avec une volatilité locale ou une courbe de taux, l'opérateur est reconstruit à chaque
+ * date où ses paramètres changent, à partir de tables précalculées et sans allocation ;
+ * la matrice implicite est alors refactorisée. À paramètres constants, elle n'est
+ * factorisée qu'une fois. Les dividendes discrets sont appliqués entre deux pas de temps
+ * par une passe d'interpolation sur la couche courante. Si une tolérance est fixée, la
+ * boucle s'arrête dès que la variation restante de la solution, estimée à partir des
+ * écarts entre couches consécutives, passe sous la tolérance (voir setTolerance).
+ *
+ * @param couches Couches de prix de N_ valeurs : M_ couches, ou deux utilisées en alternance
+ * @param toutesCouches true si couches contient les M_ couches
+ * @param travail Mémoire de travail, redimensionnée au besoin
+ * @return Indice dans couches de la couche de la date initiale (0 si toutesCouches)
+ */
+template <typename Real, typename Acc>
+int ThetaSchema::resoudre(Real *const *couches, bool toutesCouches, TravailTheta<Real, Acc> &travail) const
+{
+	// Paramètres de l'actif
+	const Actif &actif = getEDP().getActif();
+	const Option &option = getEDP().getOption();
+	const VolLocale *vol = actif.volLocale_.get();
+	const CourbeTaux *courbe = actif.courbeTaux_.get();
+	double T = option.getT();
+
+	// taile du systeme
+	int size = N_ - 2;
+
+	// Poids implicite et explicite
+	double wImpl = theta_ * dt_;
+	double wExpl = (1.0 - theta_) * dt_;
+
+	// Tables précalculées pour les paramètres variables
+	std::vector<double> &diffusion = travail.diffusion, &convection = travail.convection, &sig2 = travail.sig2;
+	VolLocale::IndexS index;
+	if (actif.estVariable())
+	{
+		diffusion.resize(size);
+		convection.resize(size);
+		sig2.assign(size, actif.sigma_ * actif.sigma_);
+		facteursBlackScholes(N_, L_, dS_, diffusion.data(), convection.data());
+		if (vol)
+		{
+			index = vol->indexer(&L_[1], size);
+		}
+	}
+
+	// Clé des coefficients de l'opérateur à la date t
+	auto cle = [&](double t)
+	{
+		CleOperateur k = {0, 0.0, courbe ? courbe->taux(t) : actif.r_};
+		if (vol)
+		{
+			vol->positionTemps(t, k.l, k.w);
+		}
+		return k;
+	};
+
+	// Taux constant équivalent jusqu'à l'échéance, pour les conditions aux bords
+	auto tauxBord = [&](double t)
+	{
+		return courbe ? courbe->tauxMoyen(t, T) : actif.r_;
+	};
+
+	// Deux jeux de coefficients de l'opérateur : au temps m + 1 (explicite) et au temps m (implicite)
+	std::vector<Acc>(&coef)[2][3] = travail.coef;
+	for (auto &jeu : coef)
+		for (auto &v : jeu)
+			v.resize(size);
+
+	auto construire = [&](const CleOperateur &k, std::vector<Acc> *abc)
+	{
+		if (!actif.estVariable())
+		{
+			operateurBlackScholes(N_, L_, dS_, actif.sigma_, actif.r_, abc[0].data(), abc[1].data(), abc[2].data());
+			return;
+		}
+		if (vol)
+		{
+			vol->carreLigne(index, k.l, k.w, sig2.data());
+		}
+		operateurLocal(size, diffusion.data(), convection.data(), sig2.data(), k.r, abc[0].data(), abc[1].data(), abc[2].data());
+	};
+
+	// Matrice (I - theta dt L) et sa factorisation
+	std::vector<Acc> &l = travail.l, &d = travail.d, &u = travail.u;
+	std::vector<Acc> &c_prime = travail.c_prime, &inv_pivot = travail.inv_pivot, &r_prime = travail.r_prime;
+	for (std::vector<Acc> *v : {&l, &d, &u, &c_prime, &inv_pivot, &r_prime})
+		v->resize(size);
+
+	// Second membre et couche intermédiaire des demi-pas de Rannacher
+	std::vector<Real> &rhs = travail.rhs, &demi = travail.demi;
+	rhs.resize(size);
+	if (nbRannacher_ > 0)
+		demi.resize(N_);
+
+	// Couches de prix
+	auto couche = [&](int k) -> Real * { return couches[toutesCouches ? k : k & 1]; };
+	int mFin = 0; // Dernière couche calculée
+
+	// Dividendes discrets, ramenés au noeud de temps le plus proche
+	auto noeudDividende = [&](const Dividende &div)
+	{
+		return std::min(std::max((int)((div.t_ - t_[0]) / dt_ + 0.5), 0), M_ - 1);
+	};
+	std::vector<double> &saut = travail.saut;
+	saut.assign(M_, 0.0);
+	for (const Dividende &div : actif.dividendes_)
+	{
+		if (div.t_ > 0.0 && div.t_ < T)
+		{
+			saut[noeudDividende(div)] += div.montant_;
+		}
+	}
+
+	// Au bord supérieur, le sous-jacent est diminué de la valeur actuelle des dividendes encore à
+	// verser après la couche m (S - sum D e^{-r(t_i - t)}) : exact pour un call profondément dans la monnaie
+	auto sBord = [&](int m, double t, double r)
+	{
+		double Smax = L_[N_ - 1];
+		for (const Dividende &div : actif.dividendes_)
+		{
+			int k = noeudDividende(div);
+			if (div.t_ > 0.0 && div.t_ < T && k > m)
+			{
+				Smax -= div.montant_ * std::exp(-r * (t_[k] - t));
+			}
+		}
+		return Smax;
+	};
+
+	// Condition terminale (payoff)
+	for (int i = 0; i < N_; ++i)
+	{
+		couche(M_ - 1)[i] = Real(option.payoff(L_[i]));
+	}
+	if (saut[M_ - 1] > 0.0)
+	{
+		sauterDividende(N_, dS_, saut[M_ - 1], couche(M_ - 1));
+	}
+
+	// Arrêt anticipé possible au pas m si m <= mLibre : plus de dividende ni de changement d'opérateur avant t_0
+	pasEconomises_ = 0;
+	double ecartPrec = -1.0; // Écart entre les deux couches précédentes, négatif si inconnu
+	int mLibre = -1;
+	if (tolerance_ > 0.0)
+	{
+		CleOperateur cle0 = cle(t_[0]);
+		mLibre = 0;
+		while (mLibre + 1 < M_ && saut[mLibre] == 0.0 && cle(t_[mLibre + 1]) == cle0)
+		{
+			++mLibre;
+		}
+	}
+
+	int prec = 0; // Jeu de coefficients au temps m + 1
+	CleOperateur clePrec = cle(t_[M_ - 1]), cleFactorisee = clePrec;
+	construire(clePrec, coef[prec]);
+	bool factorisee = false;
+
+	// Boucle sur le temps (de T vers 0)
+	for (int m = M_ - 2; m >= 0; --m)
+	{
+		// Coefficients au temps m : reconstruits seulement si les paramètres ont changé
+		CleOperateur cleCour = cle(t_[m]);
+		int cour = prec;
+		if (cleCour != clePrec)
+		{
+			cour = 1 - prec;
+			construire(cleCour, coef[cour]);
+		}
+		const std::vector<Acc> *abc = coef[cour], *abcPrec = coef[prec];
+
+		// Démarrage de Rannacher : premiers pas remplacés par deux demi-pas implicites
+		bool rannacher = M_ - 2 - m < nbRannacher_;
+
+		// À paramètres constants, factorisation unique ; sinon, résolution fusionnée à chaque pas
+		bool constant = cleCour == clePrec && cleCour == cleFactorisee;
+		if (constant && !factorisee && !rannacher)
+		{
+			matriceImplicite(size, abc[0].data(), abc[1].data(), abc[2].data(), wImpl, l.data(), d.data(), u.data());
+			thomasFactoriser(size, l.data(), d.data(), u.data(), c_prime.data(), inv_pivot.data());
+			factorisee = true;
+		}
+
+		// Conditions aux bords
+		double rBord = tauxBord(t_[m]);
+		couche(m)[0] = Real(option.lowerBoundary(t_[m], rBord));
+		couche(m)[N_ - 1] = Real(option.upperBoundary(sBord(m, t_[m], rBord), t_[m], rBord));
+
+		if (rannacher)
+		{
+			// Demi-pas implicite de t_{m+1} à t_{m+1/2}, puis de t_{m+1/2} à t_m
+			double tDemi = 0.5 * (t_[m] + t_[m + 1]), rDemi = tauxBord(tDemi);
+			Acc wDemi = Acc(0.5 * dt_);
+			demi[0] = Real(option.lowerBoundary(tDemi, rDemi));
+			demi[N_ - 1] = Real(option.upperBoundary(sBord(m, tDemi, rDemi), tDemi, rDemi));
+			std::copy(couche(m + 1) + 1, couche(m + 1) + N_ - 1, rhs.begin());
+			injecterBords(size, abc[0].data(), abc[2].data(), wDemi, demi.data(), rhs.data());
+			resoudreImplicite(size, abc[0].data(), abc[1].data(), abc[2].data(), wDemi, rhs.data(), &demi[1], c_prime.data(), r_prime.data());
+			std::copy(demi.begin() + 1, demi.end() - 1, rhs.begin());
+			injecterBords(size, abc[0].data(), abc[2].data(), wDemi, couche(m), rhs.data());
+			resoudreImplicite(size, abc[0].data(), abc[1].data(), abc[2].data(), wDemi, rhs.data(), couche(m) + 1, c_prime.data(), r_prime.data());
+			factorisee = false;
+			cleFactorisee = cleCour;
+		}
+		else
+		{
+			// Second membre : partie explicite puis termes de bord connus au temps m
+			appliquerOperateur(size, abcPrec[0].data(), abcPrec[1].data(), abcPrec[2].data(), Acc(wExpl), couche(m + 1), rhs.data());
+			injecterBords(size, abc[0].data(), abc[2].data(), Acc(wImpl), couche(m), rhs.data());
+
+			// Résolution du système tridiagonal, directement dans les valeurs internes
+			if (constant)
+			{
+				thomasSubstituer(size, l.data(), c_prime.data(), inv_pivot.data(), rhs.data(), couche(m) + 1, r_prime.data());
+			}
+			else
+			{
+				resoudreImplicite(size, abc[0].data(), abc[1].data(), abc[2].data(), Acc(wImpl), rhs.data(), couche(m) + 1, c_prime.data(), r_prime.data());
+				factorisee = false;
+				cleFactorisee = cleCour;
+			}
+		}
+
+		// Juste avant le détachement, le sous-jacent vaut S et vaudra S - D juste après
+		if (saut[m] > 0.0)
+		{
+			sauterDividende(N_, dS_, saut[m], couche(m));
+		}
+
+		prec = cour;
+		clePrec = cleCour;
+
+		// Arrêt anticipé : l'écart entre couches décroît géométriquement (raison q), la variation
+		// restante jusqu'à t_0 est majorée par ecart * q / (1 - q)
+		if (m > 0 && m <= mLibre)
+		{
+			if (!couchesProches(N_, couche(m), couche(m + 1), tolerance_))
+			{
+				ecartPrec = -1.0;
+				continue;
+			}
+			double ecart = ecartCouches(N_, couche(m), couche(m + 1));
+			double q = ecartPrec > 0.0 ? ecart / ecartPrec : 1.0;
+			if (ecart == 0.0 || (q < 1.0 && ecart * q / (1.0 - q) < tolerance_))
+			{
+				for (int k = m - 1; k >= 0 && toutesCouches; --k)
+				{
+					std::copy(couches[m], couches[m] + N_, couches[k]);
+				}
+				pasEconomises_ = m;
+				mFin = m;
+				break;
+			}
+			ecartPrec = ecart;
+		}
+	}
+
+	return toutesCouches ? 0 : mFin & 1;
+}
+
+/**
+ * @brief Résout l'EDP en utilisant le theta-schéma dans le type scalaire choisi
+ * @return Matrice des prix de l'option aux différents points de la grille
+ */
+template <typename Real, typename Acc>
+std::vector<std::vector<Real>> ThetaSchema::solveAs() const
+{
+	std::vector<std::vector<Real>> V(M_, std::vector<Real>(N_));
+	std::vector<Real *> couches(M_);
+	for (int m = 0; m < M_; ++m)
+		couches[m] = V[m].data();
+	TravailTheta<Real, Acc> travail;
+	resoudre<Real, Acc>(couches.data(), true, travail);
+	return V;
+}
+
+/**
+ * @brief Résout l'EDP en ne conservant que deux couches de prix
+ * @return Prix à la date initiale
+ */
+std::vector<double> ThetaSchema::solveInitiale() const
+{
+	std::vector<double> prix(N_);
+	TravailTheta<double> travail;
+	solveInitiale(prix.data(), travail);
+	return prix;
+}
+
+/**
+ * @brief Résout l'EDP en ne conservant que deux couches, sans allocation une fois travail dimensionné
+ * @param prix Prix à la date initiale, N valeurs écrites par la résolution
+ * @param travail Mémoire de travail, réutilisable d'une résolution à l'autre
+ */
+void ThetaSchema::solveInitiale(double *prix, TravailTheta<double> &travail) const
+{
+	travail.couche.resize(N_);
+	double *couches[2] = {prix, travail.couche.data()};
+	if (resoudre<double, double>(couches, false, travail) == 1)
+	{
+		std::copy(travail.couche.begin(), travail.couche.end(), prix);
+	}
+}
+
+/**
+ * @brief Résout l'EDP en écrivant toutes les couches dans la mémoire de l'appelant
+ * @param couches M pointeurs vers des couches de N valeurs, la couche m recevant les prix en t_m
+ * @param travail Mémoire de travail, réutilisable d'une résolution à l'autre
+ */
+void ThetaSchema::solveDans(double *const *couches, TravailTheta<double> &travail) const
+{
+	resoudre<double, double>(couches, true, travail);
+}
+
+// Instanciations : double, float et mixte (stockage float, accumulation double)
+template std::vector<std::vector<double>> ThetaSchema::solveAs<double, double>() const;
+template std::vector<std::vector<float>> ThetaSchema::solveAs<float, float>() const;
+template std::vector<std::vector<float>> ThetaSchema::solveAs<float, double>() const;
@@ -0,0 +1,157 @@
+/**
+ * @file Thomas.hpp
+ * @brief Noyau de l'algorithme de Thomas, générique sur le type scalaire
+ */
+
+#ifndef THOMAS_HPP
+#define THOMAS_HPP
+
+/**
+ * @brief Résolution en place d'un système tridiagonal par la méthode de Thomas, sans allocation
+ *
+ * Le stockage (coefficients, second membre, solution) est en `Real` ; la récurrence
+ * (coefficients modifiés c' et r') est calculée et conservée en `Acc`. Avec
+ * Real = float et Acc = double on obtient le mode mixte : stockage simple précision
+ * et accumulation double précision.
+ *
+ * @param n Taille du système
+ * @param l Coefficients sous-diagonaux (n - 1)
+ * @param d Coefficients diagonaux (n)
+ * @param u Coefficients sur-diagonaux (n - 1)
+ * @param r Second membre (n)
+ * @param x Solution (n), peut être confondu avec r
+ * @param c_prime Espace de travail (n)
+ * @param r_prime Espace de travail (n)
+ */
+template <typename Real, typename Acc>
+void thomasResoudre(int n, const Real *l, const Real *d, const Real *u, const Real *r, Real *x,
+					Acc *c_prime, Acc *r_prime)
+{
+	// Étape avant forward
+	Acc inv = Acc(1) / Acc(d[0]);
+	c_prime[0] = n > 1 ? Acc(u[0]) * inv : Acc(0);
+	r_prime[0] = Acc(r[0]) * inv;
+
+	// Forward elimination
+	for (int i = 1; i < n; ++i)
+	{
+		Acc li = Acc(l[i - 1]);
+		inv = Acc(1) / (Acc(d[i]) - li * c_prime[i - 1]);
+		c_prime[i] = i < n - 1 ? Acc(u[i]) * inv : Acc(0);
+		r_prime[i] = (Acc(r[i]) - li * r_prime[i - 1]) * inv;
+	}
+
+	// Back substitution
+	Acc suivant = r_prime[n - 1];
+	x[n - 1] = Real(suivant);
+	for (int i = n - 2; i >= 0; --i)
+	{
+		suivant = r_prime[i] - c_prime[i] * suivant;
+		x[i] = Real(suivant);
+	}
+}
+
+/**
+ * @brief Factorisation LU d'une matrice tridiagonale constante, à réutiliser à chaque pas de temps
+ *
+ * Stocke les coefficients sur-diagonaux modifiés c' et les inverses des pivots, de sorte
+ * que chaque résolution ultérieure (thomasSubstituer) ne contient plus aucune division.
+ *
+ * @param n Taille du système
+ * @param l Coefficients sous-diagonaux (n - 1)
+ * @param d Coefficients diagonaux (n)
+ * @param u Coefficients sur-diagonaux (n - 1)
+ * @param c_prime Coefficients sur-diagonaux modifiés (n)
+ * @param inv_pivot Inverses des pivots (n)
+ */
+template <typename Real, typename Acc>
+void thomasFactoriser(int n, const Real *l, const Real *d, const Real *u, Acc *c_prime, Acc *inv_pivot)
+{
+	inv_pivot[0] = Acc(1) / Acc(d[0]);
+	c_prime[0] = n > 1 ? Acc(u[0]) * inv_pivot[0] : Acc(0);
+	for (int i = 1; i < n; ++i)
+	{
+		inv_pivot[i] = Acc(1) / (Acc(d[i]) - Acc(l[i - 1]) * c_prime[i - 1]);
+		c_prime[i] = i < n - 1 ? Acc(u[i]) * inv_pivot[i] : Acc(0);
+	}
+}
+
+/**
+ * @brief Résolution d'un système tridiagonal déjà factorisé par thomasFactoriser
+ * @param n Taille du système
+ * @param l Coefficients sous-diagonaux (n - 1), ceux passés à la factorisation (en précision d'accumulation)
+ * @param c_prime Coefficients sur-diagonaux modifiés (n)
+ * @param inv_pivot Inverses des pivots (n)
+ * @param r Second membre (n)
+ * @param x Solution (n), peut être confondu avec r
+ * @param r_prime Espace de travail (n)
+ */
+template <typename Real, typename Acc>
+void thomasSubstituer(int n, const Acc *l, const Acc *c_prime, const Acc *inv_pivot, const Real *r, Real *x,
+					  Acc *r_prime)
+{
+	// Forward elimination
+	r_prime[0] = Acc(r[0]) * inv_pivot[0];
+	for (int i = 1; i < n; ++i)
+	{
+		r_prime[i] = (Acc(r[i]) - l[i - 1] * r_prime[i - 1]) * inv_pivot[i];
+	}
+
+	// Back substitution
+	Acc suivant = r_prime[n - 1];
+	x[n - 1] = Real(suivant);
+	for (int i = n - 2; i >= 0; --i)
+	{
+		suivant = r_prime[i] - c_prime[i] * suivant;
+		x[i] = Real(suivant);
+	}
+}
+
+/**
+ * @brief Résolution en place d'un lot de systèmes tridiagonaux partageant la même matrice factorisée
+ *
+ * L'élément j du système k est rangé en x[j * ld + k] : pour chaque ligne j, la boucle
+ * interne parcourt les systèmes contigus en mémoire, ce qui se vectorise. La matrice est
+ * celle passée à thomasFactoriser ; l, c' et les inverses des pivots sont indicés par ligne.
+ *
+ * @param n Taille de chaque système
+ * @param nb Nombre de systèmes
+ * @param ld Écart en mémoire entre deux lignes consécutives (ld >= nb)
+ * @param l Coefficients sous-diagonaux (n - 1), ceux passés à la factorisation
+ * @param c_prime Coefficients sur-diagonaux modifiés (n)
+ * @param inv_pivot Inverses des pivots (n)
+ * @param x Seconds membres en entrée, solutions en sortie (n lignes de ld valeurs)
+ */
+template <typename Real, typename Acc>
+void thomasSubstituerLot(int n, int nb, int ld, const Acc *l, const Acc *c_prime, const Acc *inv_pivot, Real *x)
+{
+	// Forward elimination
+	for (int k = 0; k < nb; ++k)
+	{
+		x[k] = Real(Acc(x[k]) * inv_pivot[0]);
+	}
+	for (int j = 1; j < n; ++j)
+	{
+		Real *xj = x + (size_t)j * ld;
+		const Real *xp = xj - ld;
+		Acc lj = l[j - 1], inv = inv_pivot[j];
+		for (int k = 0; k < nb; ++k)
+		{
+			xj[k] = Real((Acc(xj[k]) - lj * Acc(xp[k])) * inv);
+		}
+	}
+
+	// Back substitution
+	for (int j = n - 2; j >= 0; --j)
+	{
+		Real *xj = x + (size_t)j * ld;
+		const Real *xs = xj + ld;
+		Acc cj = c_prime[j];
+		for (int k = 0; k < nb; ++k)
+		{
+			xj[k] = Real(Acc(xj[k]) - cj * Acc(xs[k]));
+		}
+	}
+}
+
+#endif
@@ -0,0 +1,977 @@
+/**
+ * @file bench.cpp
+ * @brief Micro-benchmarks de ThomasAlgo, des schémas aux différences finies (double, float, mixte, paramètres
+ * variables, barrières et dividendes), du solveur ADI de Heston, du dimensionnement automatique,
+ * du moteur de scénarios, de l'équation forward de Dupire, du Monte-Carlo, de l'interface C et du pricing par lots
+ *
+ * Le harnais suit la logique de Google Benchmark : chaque cas est calibré pour
+ * durer au moins `--min-time` secondes, puis répété `--repetitions` fois. On
+ * rapporte le minimum, la médiane, la moyenne et l'écart-type du temps par
+ * itération, ainsi qu'un débit (éléments par seconde).
+ *
+ * Les résultats sont écrits en JSON (une ligne par benchmark) afin de pouvoir
+ * être comparés d'une version à l'autre avec `--compare=ancien.json`.
+ *
+ * Usage : bench [--filter=motif] [--min-time=0.2] [--repetitions=5]
+ *               [--out=bench_results.json] [--compare=ref.json] [--seuil=0.05]
+ */
+
+#include "../DifferenceFinie.hpp"
+#include "../Dimensionnement.hpp"
+#include "../Dupire.hpp"
+#include "../EDP.hpp"
+#include "../Heston.hpp"
+#include "../MonteCarlo.hpp"
+#include "../Option.hpp"
+#include "../Scenarios.hpp"
+#include "../bs_c.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <ctime>
+#include <fstream>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace
+{
+
+/**
+ * @brief Puits pour empêcher le compilateur d'éliminer les calculs mesurés
+ */
+volatile double puits = 0.0;
+
+/**
+ * @struct Benchmark
+ * @brief Cas de benchmark : un nom, une fonction à mesurer et le nombre d'éléments traités par appel
+ */
+struct Benchmark
+{
+	std::string nom;			 // Nom du cas (ex : "ThomasAlgo/1024")
+	std::function<void()> corps; // Code mesuré, exécuté une fois par itération
+	double elements;			 // Éléments traités par itération (pour le débit)
+	std::string unite;			 // Nom des éléments (noeuds, contrats...)
+};
+
+/**
+ * @struct Resultat
+ * @brief Statistiques agrégées d'un benchmark (temps en nanosecondes par itération)
+ */
+struct Resultat
+{
+	std::string nom;
+	long iterations;
+	int repetitions;
+	double min_ns;
+	double mediane_ns;
+	double moyenne_ns;
+	double ecartType_ns;
+	double debit; // éléments par seconde (sur la médiane)
+	std::string unite;
+};
+
+/**
+ * @struct Config
+ * @brief Paramètres de la ligne de commande
+ */
+struct Config
+{
+	std::string filtre;
+	double tempsMin = 0.2;
+	int repetitions = 5;
+	std::string sortie = "bench_results.json";
+	std::string reference;
+	double seuil = 0.05;
+};
+
+/**
+ * @brief Mesure la durée de `iterations` appels à `corps`
+ * @return Durée totale en secondes
+ */
+double chronometrer(const std::function<void()> &corps, long iterations)
+{
+	auto debut = std::chrono::steady_clock::now();
+	for (long k = 0; k < iterations; ++k)
+	{
+		corps();
+	}
+	auto fin = std::chrono::steady_clock::now();
+	return std::chrono::duration<double>(fin - debut).count();
+}
+
+/**
+ * @brief Exécute un benchmark : échauffement, calibrage du nombre d'itérations puis répétitions
+ */
+Resultat executer(const Benchmark &bench, const Config &config)
+{
+	// Échauffement (caches, pages mémoire, prédicteurs de branchement)
+	bench.corps();
+
+	// Calibrage : on double le nombre d'itérations jusqu'à atteindre le temps minimal
+	long iterations = 1;
+	double duree = chronometrer(bench.corps, iterations);
+	while (duree < config.tempsMin && iterations < (1L << 30))
+	{
+		double facteur = duree > 0.0 ? 1.4 * config.tempsMin / duree : 10.0;
+		iterations = std::max(iterations + 1, (long)(iterations * std::min(facteur, 10.0)));
+		duree = chronometrer(bench.corps, iterations);
+	}
+
+	// Répétitions
+	std::vector<double> temps(config.repetitions);
+	temps[0] = duree / iterations * 1e9;
+	for (int k = 1; k < config.repetitions; ++k)
+	{
+		temps[k] = chronometrer(bench.corps, iterations) / iterations * 1e9;
+	}
+
+	Resultat res;
+	res.nom = bench.nom;
+	res.iterations = iterations;
+	res.repetitions = config.repetitions;
+	res.unite = bench.unite;
+
+	std::vector<double> tri(temps);
+	std::sort(tri.begin(), tri.end());
+	size_t n = tri.size();
+	res.min_ns = tri.front();
+	res.mediane_ns = (n % 2 == 1) ? tri[n / 2] : 0.5 * (tri[n / 2 - 1] + tri[n / 2]);
+
+	double somme = 0.0;
+	for (double x : temps)
+		somme += x;
+	res.moyenne_ns = somme / n;
+
+	double var = 0.0;
+	for (double x : temps)
+		var += (x - res.moyenne_ns) * (x - res.moyenne_ns);
+	res.ecartType_ns = n > 1 ? std::sqrt(var / (n - 1)) : 0.0;
+
+	res.debit = bench.elements / (res.mediane_ns * 1e-9);
+	return res;
+}
+
+/**
+ * @brief Construit une grille uniforme [0, xmax] à n points
+ */
+std::vector<double> grille(int n, double xmax)
+{
+	std::vector<double> g(n);
+	for (int i = 0; i < n; ++i)
+		g[i] = i * xmax / (n - 1);
+	return g;
+}
+
+/**
+ * @brief Enregistre les cas ThomasAlgo pour plusieurs tailles de système
+ */
+void ajouterThomas(std::vector<Benchmark> &benchs)
+{
+	const int tailles[] = {64, 256, 1024, 4096, 16384, 65536};
+	for (int n : tailles)
+	{
+		// Système diagonalement dominant, représentatif des schémas implicites
+		std::vector<double> l(n - 1, -1.0), d(n, 4.0), u(n - 1, -1.0), r(n);
+		for (int i = 0; i < n; ++i)
+			r[i] = std::sin(0.01 * i);
+
+		Benchmark b;
+		b.nom = "ThomasAlgo/" + std::to_string(n);
+		b.corps = [l, d, u, r]()
+		{
+			std::vector<double> x = ThomasAlgo(l, d, u, r);
+			puits = x[x.size() / 2];
+		};
+		b.elements = n;
+		b.unite = "noeuds";
+		benchs.push_back(b);
+
+		// Noyau sans allocation, en float et en mixte
+		std::vector<float> lf(l.begin(), l.end()), df(d.begin(), d.end()), uf(u.begin(), u.end()), rf(r.begin(), r.end());
+		Benchmark bf;
+		bf.nom = "thomasResoudre<float>/" + std::to_string(n);
+		bf.corps = [lf, df, uf, rf, n]()
+		{
+			static std::vector<float> x, cp, rp;
+			x.resize(n), cp.resize(n), rp.resize(n);
+			thomasResoudre(n, lf.data(), df.data(), uf.data(), rf.data(), x.data(), cp.data(), rp.data());
+			puits = x[n / 2];
+		};
+		bf.elements = n;
+		bf.unite = "noeuds";
+		benchs.push_back(bf);
+
+		Benchmark bm = bf;
+		bm.nom = "thomasResoudre<float,double>/" + std::to_string(n);
+		bm.corps = [lf, df, uf, rf, n]()
+		{
+			static std::vector<float> x;
+			static std::vector<double> cp, rp;
+			x.resize(n), cp.resize(n), rp.resize(n);
+			thomasResoudre(n, lf.data(), df.data(), uf.data(), rf.data(), x.data(), cp.data(), rp.data());
+			puits = x[n / 2];
+		};
+		benchs.push_back(bm);
+	}
+}
+
+/**
+ * @brief Enregistre les cas Crank_Nicholson et Implicite pour plusieurs tailles de grille (N, M)
+ */
+void ajouterSchemas(std::vector<Benchmark> &benchs)
+{
+	const int tailles[][2] = {{100, 100}, {250, 250}, {500, 500}, {1000, 1000}, {2000, 200}};
+	const double T = 1.0, K = 100.0, Smax = 300.0;
+
+	for (const auto &taille : tailles)
+	{
+		int N = taille[0], M = taille[1];
+		std::string suffixe = "/" + std::to_string(N) + "/" + std::to_string(M);
+		std::vector<double> S = grille(N + 1, Smax);
+		std::vector<double> t = grille(M + 1, T);
+
+		Benchmark cn;
+		cn.nom = "Crank_Nicholson::solve" + suffixe;
+		cn.corps = [S, t, N, M, K, T]()
+		{
+			Actif actif(K, 0.1, 0.2);
+			Call call(K, T);
+			EDPComplete edp(call, actif);
+			Crank_Nicholson schema(edp, N + 1, M + 1, S, t);
+			auto V = schema.solve();
+			puits = V[0][N / 3];
+		};
+		cn.elements = (double)(N + 1) * (M + 1);
+		cn.unite = "noeuds";
+		benchs.push_back(cn);
+
+		Benchmark imp;
+		imp.nom = "Implicite::solve" + suffixe;
+		imp.corps = [S, t, N, M, K, T]()
+		{
+			Actif actif(K, 0.1, 0.2);
+			Call call(K, T);
+			EDPReduite edp(call, actif);
+			Implicite schema(edp, N + 1, M + 1, S, t);
+			auto V = schema.solve();
+			puits = V[0][N / 3];
+		};
+		imp.elements = (double)(N + 1) * (M + 1);
+		imp.unite = "noeuds";
+		benchs.push_back(imp);
+
+		// Précision simple et mixte (stockage float, accumulation double)
+		Benchmark cnFloat = cn;
+		cnFloat.nom = "Crank_Nicholson::solveAs<float>" + suffixe;
+		cnFloat.corps = [S, t, N, M, K, T]()
+		{
+			Actif actif(K, 0.1, 0.2);
+			Call call(K, T);
+			EDPComplete edp(call, actif);
+			Crank_Nicholson schema(edp, N + 1, M + 1, S, t);
+			auto V = schema.solveAs<float>();
+			puits = V[0][N / 3];
+		};
+		benchs.push_back(cnFloat);
+
+		Benchmark cnMixte = cn;
+		cnMixte.nom = "Crank_Nicholson::solveAs<float,double>" + suffixe;
+		cnMixte.corps = [S, t, N, M, K, T]()
+		{
+			Actif actif(K, 0.1, 0.2);
+			Call call(K, T);
+			EDPComplete edp(call, actif);
+			Crank_Nicholson schema(edp, N + 1, M + 1, S, t);
+			auto V = schema.solveAs<float, double>();
+			puits = V[0][N / 3];
+		};
+		benchs.push_back(cnMixte);
+	}
+}
+
+/**
+ * @brief Enregistre les schémas d'ordre élevé : BDF2 et TR_BDF2 avec peu de pas de temps, CompactOrdre4 avec peu de points
+ */
+void ajouterSchemasOrdre2(std::vector<Benchmark> &benchs)
+{
+	const int tailles[][2] = {{1000, 25}, {1000, 50}, {1000, 1000}};
+	const double T = 1.0, K = 100.0, Smax = 300.0;
+
+	for (const auto &taille : tailles)
+	{
+		int N = taille[0], M = taille[1];
+		std::string suffixe = "/" + std::to_string(N) + "/" + std::to_string(M);
+		std::vector<double> S = grille(N + 1, Smax);
+		std::vector<double> t = grille(M + 1, T);
+
+		Benchmark bdf;
+		bdf.nom = "BDF2::solve" + suffixe;
+		bdf.corps = [S, t, N, M, K, T]()
+		{
+			Actif actif(K, 0.1, 0.2);
+			Call call(K, T);
+			EDPComplete edp(call, actif);
+			BDF2 schema(edp, N + 1, M + 1, S, t);
+			auto V = schema.solve();
+			puits = V[0][N / 3];
+		};
+		bdf.elements = (double)(N + 1) * (M + 1);
+		bdf.unite = "noeuds";
+		benchs.push_back(bdf);
+
+		Benchmark tr = bdf;
+		tr.nom = "TR_BDF2::solve" + suffixe;
+		tr.corps = [S, t, N, M, K, T]()
+		{
+			Actif actif(K, 0.1, 0.2);
+			Call call(K, T);
+			EDPComplete edp(call, actif);
+			TR_BDF2 schema(edp, N + 1, M + 1, S, t);
+			auto V = schema.solve();
+			puits = V[0][N / 3];
+		};
+		benchs.push_back(tr);
+	}
+
+	// Schéma compact d'ordre 4 sur grille logarithmique
+	const int taillesCompact[][2] = {{100, 200}, {400, 200}};
+	for (const auto &taille : taillesCompact)
+	{
+		int N = taille[0], M = taille[1];
+		std::vector<double> S = grilleLog(K * std::exp(-1.6), K * std::exp(1.6), N + 1);
+		std::vector<double> t = grille(M + 1, T);
+
+		Benchmark c4;
+		c4.nom = "CompactOrdre4::solve/" + std::to_string(N) + "/" + std::to_string(M);
+		c4.corps = [S, t, N, M, K, T]()
+		{
+			Actif actif(K, 0.1, 0.2);
+			Call call(K, T);
+			EDPComplete edp(call, actif);
+			CompactOrdre4 schema(edp, N + 1, M + 1, S, t);
+			auto V = schema.solve();
+			puits = V[0][N / 2];
+		};
+		c4.elements = (double)(N + 1) * (M + 1);
+		c4.unite = "noeuds";
+		benchs.push_back(c4);
+	}
+}
+
+/**
+ * @brief Enregistre Crank-Nicholson avec volatilité locale et courbe de taux, à comparer au cas à paramètres constants
+ */
+void ajouterMarche(std::vector<Benchmark> &benchs)
+{
+	const int N = 1000, M = 1000;
+	const double T = 1.0, K = 100.0, Smax = 300.0;
+	std::vector<double> S = grille(N + 1, Smax);
+	std::vector<double> t = grille(M + 1, T);
+
+	// Surface sigma(S, t) sur 30 x 12 piliers et courbe de taux sur 12 piliers
+	std::vector<double> piliersS(30), piliersT(12), surface, taux(12);
+	for (int i = 0; i < 30; ++i)
+		piliersS[i] = 10.0 * (i + 1);
+	for (int l = 0; l < 12; ++l)
+	{
+		piliersT[l] = l * T / 11;
+		taux[l] = 0.02 + 0.005 * l;
+		for (int i = 0; i < 30; ++i)
+			surface.push_back(0.15 + 0.1 * std::abs(std::log(piliersS[i] / K)) + 0.01 * l);
+	}
+	auto courbe = std::make_shared<const CourbeTaux>(piliersT, taux);
+	auto vol = std::make_shared<const VolLocale>(piliersS, piliersT, surface);
+	auto volConstanteParMorceaux = std::make_shared<const VolLocale>(piliersS, piliersT, surface, false);
+
+	struct Cas
+	{
+		const char *nom;
+		std::shared_ptr<const VolLocale> vol;
+		std::shared_ptr<const CourbeTaux> courbe;
+	};
+	const Cas cas[] = {{"constant", nullptr, nullptr},
+					   {"courbeTaux", nullptr, courbe},
+					   {"volLocale", vol, courbe},
+					   {"volLocaleParMorceaux", volConstanteParMorceaux, nullptr}};
+
+	for (const Cas &c : cas)
+	{
+		Benchmark b;
+		b.nom = std::string("Crank_Nicholson::solve/") + c.nom + "/" + std::to_string(N) + "/" + std::to_string(M);
+		b.corps = [S, t, N, M, K, T, c]()
+		{
+			Actif actif(K, 0.05, 0.2);
+			actif.volLocale_ = c.vol;
+			actif.courbeTaux_ = c.courbe;
+			Call call(K, T);
+			EDPComplete edp(call, actif);
+			Crank_Nicholson schema(edp, N + 1, M + 1, S, t);
+			auto V = schema.solve();
+			puits = V[0][N / 3];
+		};
+		b.elements = (double)(N + 1) * (M + 1);
+		b.unite = "noeuds";
+		benchs.push_back(b);
+	}
+}
+
+/**
+ * @brief Enregistre Crank-Nicholson sur une option à barrière (grille tronquée) et avec un dividende discret
+ */
+void ajouterEvenements(std::vector<Benchmark> &benchs)
+{
+	const int M = 1000;
+	const double T = 1.0, K = 100.0, B = 90.0, Smax = 300.0;
+	std::vector<double> t = grille(M + 1, T);
+
+	// Call down-and-out : domaine [B, Smax] au même pas que la grille vanille [0, Smax] à 1000 points
+	const int Nb = 700;
+	Call call(K, T);
+	std::vector<double> Sb = grilleBarriere(OptionBarriere(call, Barriere::Basse, B), Smax, Nb + 1);
+	Benchmark barriere;
+	barriere.nom = "Crank_Nicholson::solve/barriereBasse/" + std::to_string(Nb) + "/" + std::to_string(M);
+	barriere.corps = [Sb, t, Nb, M, K, B, T]()
+	{
+		Actif actif(K, 0.05, 0.2);
+		Call vanille(K, T);
+		OptionBarriere option(vanille, Barriere::Basse, B);
+		EDPComplete edp(option, actif);
+		Crank_Nicholson schema(edp, Nb + 1, M + 1, Sb, t);
+		auto V = schema.solve();
+		puits = V[0][Nb / 3];
+	};
+	barriere.elements = (double)(Nb + 1) * (M + 1);
+	barriere.unite = "noeuds";
+	benchs.push_back(barriere);
+
+	const int N = 1000;
+	std::vector<double> S = grille(N + 1, Smax);
+	Benchmark dividende;
+	dividende.nom = "Crank_Nicholson::solve/dividende/" + std::to_string(N) + "/" + std::to_string(M);
+	dividende.corps = [S, t, N, M, K, T]()
+	{
+		Actif actif(K, 0.05, 0.2);
+		actif.dividendes_.push_back({0.25, 1.5});
+		actif.dividendes_.push_back({0.75, 1.5});
+		Call call(K, T);
+		EDPComplete edp(call, actif);
+		Crank_Nicholson schema(edp, N + 1, M + 1, S, t);
+		auto V = schema.solve();
+		puits = V[0][N / 3];
+	};
+	dividende.elements = (double)(N + 1) * (M + 1);
+	dividende.unite = "noeuds";
+	benchs.push_back(dividende);
+}
+
+/**
+ * @brief Enregistre le solveur ADI de Heston sur une grille 200 x 100 x 100, sur un thread et sur tous les coeurs
+ */
+void ajouterHeston(std::vector<Benchmark> &benchs)
+{
+	const int ns = 200, nv = 100, M = 100;
+	const double T = 1.0, K = 100.0;
+	std::vector<double> S = grille(ns, 400.0);
+	std::vector<double> v = grille(nv, 1.0);
+	std::vector<double> t = grille(M, T);
+
+	for (int nbThreads : {1, 0})
+	{
+		Benchmark b;
+		b.nom = "Heston::solve/" + std::string(nbThreads == 1 ? "1thread" : "threads") + "/" + std::to_string(ns) + "/" +
+				std::to_string(nv) + "/" + std::to_string(M);
+		b.corps = [S, v, t, K, T, nbThreads]()
+		{
+			Actif actif(K, 0.025);
+			Call call(K, T);
+			ParametresHeston p = {1.5, 0.04, 0.3, -0.9};
+			Heston heston(call, actif, p, S, v, t, nbThreads);
+			auto V = heston.solve();
+			puits = heston.prixEn(V, K, 0.04);
+		};
+		b.elements = (double)ns * nv * M;
+		b.unite = "noeuds";
+		benchs.push_back(b);
+	}
+}
+
+/**
+ * @brief Enregistre un put de très longue maturité, avec et sans arrêt anticipé sur convergence
+ */
+void ajouterConvergence(std::vector<Benchmark> &benchs)
+{
+	const int N = 1000, M = 5000;
+	const double T = 500.0, K = 100.0, Smax = 400.0;
+	std::vector<double> S = grille(N + 1, Smax);
+	std::vector<double> t = grille(M + 1, T);
+
+	for (double tolerance : {0.0, 1e-6})
+	{
+		Benchmark b;
+		b.nom = std::string("Crank_Nicholson::solve/") + (tolerance > 0.0 ? "arretAnticipe" : "complet") + "/" +
+				std::to_string(N) + "/" + std::to_string(M);
+		b.corps = [S, t, N, M, K, T, tolerance]()
+		{
+			Actif actif(K, 0.05, 0.2);
+			Put put(K, T);
+			EDPComplete edp(put, actif);
+			Crank_Nicholson schema(edp, N + 1, M + 1, S, t);
+			schema.setTolerance(tolerance);
+			auto V = schema.solve();
+			puits = V[0][N / 4];
+		};
+		b.elements = (double)(N + 1) * (M + 1);
+		b.unite = "noeuds";
+		benchs.push_back(b);
+	}
+}
+
+/**
+ * @brief Enregistre le dimensionnement automatique de la grille (pilotes compris) pour plusieurs tolérances
+ */
+void ajouterDimensionnement(std::vector<Benchmark> &benchs)
+{
+	for (double tolerance : {1e-3, 1e-4})
+	{
+		Benchmark b;
+		std::ostringstream nom;
+		nom << "dimensionnerGrille/" << tolerance;
+		b.nom = nom.str();
+		b.corps = [tolerance]()
+		{
+			Actif actif(100.0, 0.1, 0.1);
+			Call call(100.0, 1.0);
+			puits = dimensionnerGrille(call, actif, tolerance).valeur;
+		};
+		b.elements = 1.0;
+		b.unite = "contrats";
+		benchs.push_back(b);
+	}
+}
+
+/**
+ * @brief Enregistre une échelle de scénarios (spot x vol x taux) : moteur de scénarios contre boucle de solve()
+ */
+void ajouterScenarios(std::vector<Benchmark> &benchs)
+{
+	const int N = 300, M = 300;
+	const double T = 1.0, K = 100.0, Smax = 300.0;
+	std::vector<double> S = grille(N + 1, Smax);
+	std::vector<double> t = grille(M + 1, T);
+
+	// 21 spots x 5 vols x 5 taux = 525 scénarios
+	std::vector<Scenario> scenarios;
+	for (int iv = 0; iv < 5; ++iv)
+		for (int ir = 0; ir < 5; ++ir)
+			for (int is = 0; is < 21; ++is)
+				scenarios.push_back({80.0 + 2.0 * is, 0.15 + 0.025 * iv, 0.01 + 0.01 * ir});
+	std::string suffixe = "/" + std::to_string(scenarios.size()) + "/" + std::to_string(N) + "/" + std::to_string(M);
+
+	Benchmark moteur;
+	moteur.nom = "Scenarios/moteur" + suffixe;
+	moteur.corps = [S, t, K, T, scenarios]()
+	{
+		Actif actif(K);
+		Call call(K, T);
+		MoteurScenarios m(call, actif, S, t);
+		puits = m.evaluer(scenarios)[scenarios.size() / 2];
+	};
+	moteur.elements = (double)scenarios.size();
+	moteur.unite = "scenarios";
+	benchs.push_back(moteur);
+
+	Benchmark naif = moteur;
+	naif.nom = "Scenarios/boucleSolve" + suffixe;
+	naif.corps = [S, t, N, M, K, T, scenarios]()
+	{
+		double somme = 0.0;
+		for (const Scenario &sc : scenarios)
+		{
+			Actif actif(sc.S, sc.r, sc.sigma);
+			Call call(K, T);
+			EDPComplete edp(call, actif);
+			Crank_Nicholson schema(edp, N + 1, M + 1, S, t);
+			auto V = schema.solve();
+			int j = (int)(sc.S / (S[1] - S[0]));
+			somme += V[0][j];
+		}
+		puits = somme;
+	};
+	benchs.push_back(naif);
+}
+
+/**
+ * @brief Enregistre le pricing d'une chaîne de 50 strikes x 20 maturités : une résolution de
+ * Crank-Nicholson par contrat face à une seule résolution forward de Dupire
+ */
+void ajouterDupire(std::vector<Benchmark> &benchs)
+{
+	const int N = 400, M = 200;
+	const double Smax = 400.0, Tmax = 2.0;
+	std::vector<double> S = grille(N + 1, Smax);
+	std::vector<double> strikes, maturites;
+	for (int i = 0; i < 50; ++i)
+		strikes.push_back(60.0 + 80.0 * i / 49);
+	for (int i = 0; i < 20; ++i)
+		maturites.push_back(0.1 * (i + 1));
+	std::string suffixe = "/50x20/" + std::to_string(N) + "/" + std::to_string(M);
+
+	Benchmark retro;
+	retro.nom = "Dupire/chaineRetrograde" + suffixe;
+	retro.corps = [S, strikes, maturites, N, M]()
+	{
+		Actif actif(100.0, 0.05, 0.2);
+		double somme = 0.0;
+		for (double T : maturites)
+		{
+			std::vector<double> t = grille(M + 1, T);
+			for (double K : strikes)
+			{
+				Call call(K, T);
+				EDPComplete edp(call, actif);
+				Crank_Nicholson schema(edp, N + 1, M + 1, S, t);
+				schema.setRannacher(2);
+				somme += schema.solveInitiale()[N / 4];
+			}
+		}
+		puits = somme;
+	};
+	retro.elements = (double)(strikes.size() * maturites.size());
+	retro.unite = "contrats";
+	benchs.push_back(retro);
+
+	Benchmark forward = retro;
+	forward.nom = "Dupire/chaineForward" + suffixe;
+	forward.corps = [S, strikes, maturites, M, Tmax]()
+	{
+		Actif actif(100.0, 0.05, 0.2);
+		Dupire dupire(actif, S, grille(M + 1, Tmax));
+		std::vector<std::vector<double>> C = dupire.solve();
+		double somme = 0.0;
+		for (double T : maturites)
+			for (double K : strikes)
+				somme += dupire.prixCall(C, K, T);
+		puits = somme;
+	};
+	benchs.push_back(forward);
+}
+
+/**
+ * @brief Enregistre le débit du Monte-Carlo en trajectoires par seconde : asiatique à 64 dates sur un
+ * thread et sur tous les coeurs, puis avec la variable de contrôle (une résolution de dimensionnerGrille en plus)
+ */
+void ajouterMonteCarlo(std::vector<Benchmark> &benchs)
+{
+	const long nbTrajectoires = 1L << 18;
+	const int tousCoeurs = (int)std::max(1u, std::thread::hardware_concurrency());
+	const ContratTrajectoire asiatique = {Payoff::Asiatique, true, 100.0, 1.0, 64};
+
+	auto cas = [&](const std::string &nom, int nbThreads, bool controle)
+	{
+		Benchmark b;
+		b.nom = "MonteCarlo/" + nom + "/64pas/" + std::to_string(nbThreads) + "threads";
+		b.corps = [asiatique, nbTrajectoires, nbThreads, controle]()
+		{
+			Actif actif(100.0, 0.05, 0.2);
+			MonteCarlo mc(actif, 1, nbThreads);
+			mc.setControle(controle);
+			puits = mc.evaluer(asiatique, nbTrajectoires).prix;
+		};
+		b.elements = (double)nbTrajectoires;
+		b.unite = "trajectoires";
+		benchs.push_back(b);
+	};
+	cas("asiatique", 1, false);
+	if (tousCoeurs > 1)
+		cas("asiatique", tousCoeurs, false);
+	cas("asiatiqueControle", 1, true);
+}
+
+/**
+ * @brief Enregistre les cas de l'interface C : solveInitiale en C++ (schéma et couches alloués à chaque
+ * appel) face à bs_prix_initiaux sur un contexte créé une fois, pour deux tailles de grille
+ */
+void ajouterInterfaceC(std::vector<Benchmark> &benchs)
+{
+	const int tailles[] = {50, 300};
+	const double T = 1.0, K = 100.0, Smax = 300.0;
+	for (int N : tailles)
+	{
+		const int M = N;
+		std::string suffixe = "/" + std::to_string(N) + "/" + std::to_string(M);
+		std::vector<double> S = grille(N + 1, Smax);
+		std::vector<double> t = grille(M + 1, T);
+
+		Benchmark cpp;
+		cpp.nom = "InterfaceC/solveInitiale" + suffixe;
+		cpp.corps = [S, t, N, M, K, T]()
+		{
+			Actif actif(K, 0.05, 0.2);
+			Call call(K, T);
+			EDPComplete edp(call, actif);
+			Crank_Nicholson schema(edp, N + 1, M + 1, S, t);
+			puits = schema.solveInitiale()[N / 3];
+		};
+		cpp.elements = (double)(N + 1) * (M + 1);
+		cpp.unite = "noeuds";
+		benchs.push_back(cpp);
+
+		// Grilles et sortie partagées par les copies du cas, contexte détruit avec la dernière
+		std::shared_ptr<std::vector<double>> Sc = std::make_shared<std::vector<double>>(S);
+		std::shared_ptr<std::vector<double>> tc = std::make_shared<std::vector<double>>(t);
+		std::shared_ptr<std::vector<double>> prix = std::make_shared<std::vector<double>>(N + 1);
+		bs_contexte *brut = nullptr;
+		bs_contexte_creer(Sc->data(), N + 1, tc->data(), M + 1, 0.5, &brut);
+		std::shared_ptr<bs_contexte> contexte(brut, bs_contexte_detruire);
+
+		Benchmark c = cpp;
+		c.nom = "InterfaceC/bs_prix_initiaux" + suffixe;
+		c.corps = [Sc, tc, prix, contexte, N, K]()
+		{
+			bs_contrat contrat = {BS_CALL, K, 0.05, 0.2};
+			bs_prix_initiaux(contexte.get(), &contrat, 1, prix->data(), N + 1);
+			puits = (*prix)[N / 3];
+		};
+		benchs.push_back(c);
+	}
+}
+
+/**
+ * @brief Enregistre le cas de pricing par lots : une chaîne de strikes call/put résolue séquentiellement
+ */
+void ajouterLots(std::vector<Benchmark> &benchs)
+{
+	const int tailleLot[] = {16, 64};
+	const int N = 300, M = 300;
+	const double T = 1.0, Smax = 300.0;
+	std::vector<double> S = grille(N + 1, Smax);
+	std::vector<double> t = grille(M + 1, T);
+
+	for (int nb : tailleLot)
+	{
+		Benchmark b;
+		b.nom = "Lot/Crank_Nicholson/" + std::to_string(nb) + "/" + std::to_string(N) + "/" + std::to_string(M);
+		b.corps = [S, t, nb, N, M, T]()
+		{
+			double somme = 0.0;
+			for (int k = 0; k < nb; ++k)
+			{
+				double K = 60.0 + 80.0 * k / nb;
+				Actif actif(100.0, 0.05, 0.2);
+				Call call(K, T);
+				Put put(K, T);
+				EDPComplete edpCall(call, actif), edpPut(put, actif);
+				Crank_Nicholson cnCall(edpCall, N + 1, M + 1, S, t);
+				Crank_Nicholson cnPut(edpPut, N + 1, M + 1, S, t);
+				somme += cnCall.solve()[0][N / 3] + cnPut.solve()[0][N / 3];
+			}
+			puits = somme;
+		};
+		b.elements = 2.0 * nb;
+		b.unite = "contrats";
+		benchs.push_back(b);
+	}
+}
+
+/**
+ * @brief Échappe une chaîne pour l'écriture JSON
+ */
+std::string echapper(const std::string &s)
+{
+	std::string out;
+	for (char c : s)
+	{
+		if (c == '"' || c == '\\')
+			out += '\\';
+		out += c;
+	}
+	return out;
+}
+
+/**
+ * @brief Écrit les résultats au format JSON (une ligne par benchmark pour faciliter les diffs)
+ */
+void ecrireJSON(const std::vector<Resultat> &resultats, const Config &config)
+{
+	std::ofstream f(config.sortie);
+	if (!f)
+	{
+		std::cerr << "Impossible d'écrire " << config.sortie << "\n";
+		return;
+	}
+
+	std::time_t maintenant = std::time(nullptr);
+	char date[32];
+	std::strftime(date, sizeof(date), "%Y-%m-%dT%H:%M:%S", std::localtime(&maintenant));
+
+	f << "{\n";
+	f << "  \"context\": {\"date\": \"" << date << "\", \"num_cpus\": " << std::thread::hardware_concurrency()
+	  << ", \"min_time\": " << config.tempsMin << ", \"repetitions\": " << config.repetitions
+#ifdef NDEBUG
+	  << ", \"build\": \"release\"},\n";
+#else
+	  << ", \"build\": \"debug\"},\n";
+#endif
+	f << "  \"benchmarks\": [\n";
+	f << std::setprecision(6);
+	for (size_t k = 0; k < resultats.size(); ++k)
+	{
+		const Resultat &r = resultats[k];
+		f << "    {\"name\": \"" << echapper(r.nom) << "\", \"iterations\": " << r.iterations
+		  << ", \"repetitions\": " << r.repetitions
+		  << ", \"min_ns\": " << r.min_ns << ", \"median_ns\": " << r.mediane_ns
+		  << ", \"mean_ns\": " << r.moyenne_ns << ", \"stddev_ns\": " << r.ecartType_ns
+		  << ", \"items_per_second\": " << r.debit << ", \"unit\": \"" << r.unite << "\"}"
+		  << (k + 1 < resultats.size() ? "," : "") << "\n";
+	}
+	f << "  ]\n}\n";
+}
+
+/**
+ * @brief Lit les médianes d'un fichier JSON produit par ecrireJSON
+ * @return Association nom -> médiane (ns)
+ */
+std::map<std::string, double> lireMedianes(const std::string &chemin)
+{
+	std::map<std::string, double> medianes;
+	std::ifstream f(chemin);
+	std::string ligne;
+	const std::string cleNom = "\"name\": \"", cleMed = "\"median_ns\": ";
+	while (std::getline(f, ligne))
+	{
+		size_t pNom = ligne.find(cleNom), pMed = ligne.find(cleMed);
+		if (pNom == std::string::npos || pMed == std::string::npos)
+			continue;
+		pNom += cleNom.size();
+		std::string nom = ligne.substr(pNom, ligne.find('"', pNom) - pNom);
+		medianes[nom] = std::atof(ligne.c_str() + pMed + cleMed.size());
+	}
+	return medianes;
+}
+
+/**
+ * @brief Compare les résultats à une référence et signale les régressions
+ * @return Nombre de benchmarks plus lents que la référence au-delà du seuil
+ */
+int comparer(const std::vector<Resultat> &resultats, const Config &config)
+{
+	std::map<std::string, double> reference = lireMedianes(config.reference);
+	if (reference.empty())
+	{
+		std::cerr << "Référence vide ou illisible : " << config.reference << "\n";
+		return 0;
+	}
+
+	int regressions = 0;
+	std::cout << std::defaultfloat << "\nComparaison avec " << config.reference << " (seuil " << 100.0 * config.seuil << " %)\n";
+	for (const Resultat &r : resultats)
+	{
+		auto it = reference.find(r.nom);
+		if (it == reference.end() || it->second <= 0.0)
+			continue;
+		double ecart = r.mediane_ns / it->second - 1.0;
+		bool regression = ecart > config.seuil;
+		regressions += regression;
+		std::cout << std::left << std::setw(48) << r.nom << std::right << std::showpos << std::fixed
+				  << std::setprecision(1) << std::setw(8) << 100.0 * ecart << " %" << std::noshowpos
+				  << (regression ? "  REGRESSION" : "") << "\n";
+	}
+	return regressions;
+}
+
+/**
+ * @brief Lit la valeur d'une option de la forme --nom=valeur
+ */
+bool lireOption(const std::string &arg, const std::string &nom, std::string &valeur)
+{
+	std::string prefixe = "--" + nom + "=";
+	if (arg.compare(0, prefixe.size(), prefixe) != 0)
+		return false;
+	valeur = arg.substr(prefixe.size());
+	return true;
+}
+
+} // namespace
+
+/**
+ * @brief Point d'entrée du benchmark
+ * @return 0 si aucune régression n'est détectée, 1 sinon
+ */
+int main(int argc, char **argv)
+{
+	Config config;
+	for (int k = 1; k < argc; ++k)
+	{
+		std::string arg = argv[k], v;
+		if (lireOption(arg, "filter", v))
+			config.filtre = v;
+		else if (lireOption(arg, "min-time", v))
+			config.tempsMin = std::atof(v.c_str());
+		else if (lireOption(arg, "repetitions", v))
+			config.repetitions = std::max(1, std::atoi(v.c_str()));
+		else if (lireOption(arg, "out", v))
+			config.sortie = v;
+		else if (lireOption(arg, "compare", v))
+			config.reference = v;
+		else if (lireOption(arg, "seuil", v))
+			config.seuil = std::atof(v.c_str());
+		else
+		{
+			std::cerr << "Option inconnue : " << arg << "\n";
+			return 2;
+		}
+	}
+
+	std::vector<Benchmark> benchs;
+	ajouterThomas(benchs);
+	ajouterSchemas(benchs);
+	ajouterSchemasOrdre2(benchs);
+	ajouterMarche(benchs);
+	ajouterEvenements(benchs);
+	ajouterHeston(benchs);
+	ajouterConvergence(benchs);
+	ajouterDimensionnement(benchs);
+	ajouterScenarios(benchs);
+	ajouterDupire(benchs);
+	ajouterMonteCarlo(benchs);
+	ajouterInterfaceC(benchs);
+	ajouterLots(benchs);
+
+	std::cout << std::left << std::setw(48) << "Benchmark" << std::right << std::setw(14) << "Mediane"
+			  << std::setw(14) << "Min" << std::setw(10) << "Ec.type" << std::setw(12) << "Iterations"
+			  << "  Debit\n";
+	std::cout << std::string(110, '-') << "\n";
+
+	std::vector<Resultat> resultats;
+	for (const Benchmark &b : benchs)
+	{
+		if (!config.filtre.empty() && b.nom.find(config.filtre) == std::string::npos)
+			continue;
+
+		Resultat r = executer(b, config);
+		resultats.push_back(r);
+
+		std::cout << std::left << std::setw(48) << r.nom << std::right << std::fixed << std::setprecision(0)
+				  << std::setw(11) << r.mediane_ns << " ns" << std::setw(11) << r.min_ns << " ns"
+				  << std::setprecision(1) << std::setw(8) << 100.0 * r.ecartType_ns / r.moyenne_ns << " %"
+				  << std::setw(12) << r.iterations << "  " << std::scientific << std::setprecision(3)
+				  << r.debit << " " << r.unite << "/s\n"
+				  << std::defaultfloat;
+	}
+
+	ecrireJSON(resultats, config);
+	std::cout << "\nRésultats écrits dans " << config.sortie << "\n";
+
+	if (!config.reference.empty())
+		return comparer(resultats, config) > 0 ? 1 : 0;
+	return 0;
+}
@@ -0,0 +1,237 @@
+/**
+ * @file bs_c.cpp
+ * @brief Implémentation de l'interface C : un theta-schéma construit sur la pile à chaque contrat,
+ * sur les grilles et la mémoire de travail du contexte
+ */
+
+#include "bs_c.h"
+#include "DifferenceFinie.hpp"
+#include "EDP.hpp"
+#include "Option.hpp"
+#include <algorithm>
+#include <cmath>
+#include <new>
+#include <stdexcept>
+#include <vector>
+
+/**
+ * @struct bs_contexte
+ * @brief Grilles de l'appelant, paramètres du schéma et mémoire de travail dimensionnée une fois
+ */
+struct bs_contexte
+{
+	const double *S;				// Grille des prix du sous-jacent, à l'appelant
+	const double *t;				// Grille des temps, à l'appelant
+	int nS, nt;						// Tailles des grilles
+	double theta;					// Poids de la partie implicite
+	int nbRannacher;				// Pas du démarrage de Rannacher
+	TravailTheta<double> travail;	// Mémoire de travail du theta-schéma
+	std::vector<double> couche;		// Couche de prix de bs_prix_spots
+	std::vector<double *> couches;	// Pointeurs vers les couches de bs_surface
+};
+
+namespace
+{
+
+/**
+ * @brief Vérifie qu'un contrat est cohérent
+ */
+bool contratValide(const bs_contrat &c)
+{
+	return (c.type == BS_CALL || c.type == BS_PUT) && c.K > 0.0 && std::isfinite(c.K) && c.sigma > 0.0 &&
+		   std::isfinite(c.sigma) && std::isfinite(c.r);
+}
+
+/**
+ * @brief Vérifie qu'une grille est finie, strictement croissante et uniforme (pas constant à 1e-6 près)
+ */
+bool grilleUniforme(const double *x, int n)
+{
+	const double pas = x[1] - x[0];
+	if (!std::isfinite(x[0]) || !(pas > 0.0) || !std::isfinite(pas))
+		return false;
+	for (int i = 1; i < n; ++i)
+	{
+		double ecart = x[i] - x[i - 1];
+		if (!std::isfinite(x[i]) || !(std::abs(ecart - pas) <= 1e-6 * pas))
+			return false;
+	}
+	return true;
+}
+
+/**
+ * @brief Construit l'option, l'EDP et le schéma du contrat sur la pile, puis appelle f(schema)
+ *
+ * Rien n'est alloué : Call, Put, Actif et EDPComplete ne font que référencer leurs paramètres
+ * et le schéma référence les grilles du contexte.
+ */
+template <typename F>
+void avecSchema(const bs_contexte &ctx, const bs_contrat &c, F f)
+{
+	double T = ctx.t[ctx.nt - 1];
+	Call call(c.K, T);
+	Put put(c.K, T);
+	Option &option = c.type == BS_CALL ? static_cast<Option &>(call) : static_cast<Option &>(put);
+	Actif actif(c.K, c.r, c.sigma);
+	EDPComplete edp(option, actif);
+	ThetaSchema schema(edp, ctx.nS, ctx.nt, ctx.S, ctx.t, ctx.theta);
+	schema.setRannacher(ctx.nbRannacher);
+	f(schema);
+}
+
+/**
+ * @brief Traduit une exception du solveur en statut
+ */
+bs_statut statutException()
+{
+	try
+	{
+		throw;
+	}
+	catch (const std::invalid_argument &)
+	{
+		return BS_ERREUR_ARGUMENT;
+	}
+	catch (const std::bad_alloc &)
+	{
+		return BS_ERREUR_MEMOIRE;
+	}
+	catch (...)
+	{
+		return BS_ERREUR_INTERNE;
+	}
+}
+
+} // namespace
+
+int bs_version(void)
+{
+	return BS_C_VERSION;
+}
+
+const char *bs_message(bs_statut statut)
+{
+	switch (statut)
+	{
+	case BS_OK:
+		return "succès";
+	case BS_ERREUR_ARGUMENT:
+		return "argument invalide";
+	case BS_ERREUR_MEMOIRE:
+		return "mémoire insuffisante";
+	case BS_ERREUR_INTERNE:
+		return "erreur interne du solveur";
+	}
+	return "statut inconnu";
+}
+
+bs_statut bs_contexte_creer(const double *S, int nS, const double *t, int nt, double theta, bs_contexte **contexte)
+{
+	if (!contexte)
+		return BS_ERREUR_ARGUMENT;
+	*contexte = nullptr;
+	if (!S || !t || nS < 3 || nt < 2 || !(theta >= 0.0 && theta <= 1.0) || S[0] != 0.0 ||
+		!grilleUniforme(S, nS) || !grilleUniforme(t, nt))
+		return BS_ERREUR_ARGUMENT;
+
+	try
+	{
+		bs_contexte *ctx = new bs_contexte();
+		ctx->S = S;
+		ctx->t = t;
+		ctx->nS = nS;
+		ctx->nt = nt;
+		ctx->theta = theta;
+		ctx->nbRannacher = 0;
+		ctx->travail.dimensionner(nS, nt);
+		ctx->couche.resize(nS);
+		ctx->couches.resize(nt);
+		*contexte = ctx;
+		return BS_OK;
+	}
+	catch (...)
+	{
+		return statutException();
+	}
+}
+
+void bs_contexte_detruire(bs_contexte *contexte)
+{
+	delete contexte;
+}
+
+bs_statut bs_contexte_rannacher(bs_contexte *contexte, int nbPas)
+{
+	if (!contexte || nbPas < 0)
+		return BS_ERREUR_ARGUMENT;
+	contexte->nbRannacher = nbPas;
+	return BS_OK;
+}
+
+bs_statut bs_prix_initiaux(bs_contexte *contexte, const bs_contrat *contrats, int nb, double *prix, int ldPrix)
+{
+	if (!contexte || nb < 0 || (nb > 0 && (!contrats || !prix)) || ldPrix < contexte->nS)
+		return BS_ERREUR_ARGUMENT;
+	try
+	{
+		for (int k = 0; k < nb; ++k)
+		{
+			if (!contratValide(contrats[k]))
+				return BS_ERREUR_ARGUMENT;
+			double *ligne = prix + (size_t)k * ldPrix;
+			avecSchema(*contexte, contrats[k], [&](const ThetaSchema &schema)
+					   { schema.solveInitiale(ligne, contexte->travail); });
+		}
+		return BS_OK;
+	}
+	catch (...)
+	{
+		return statutException();
+	}
+}
+
+bs_statut bs_prix_spots(bs_contexte *contexte, const bs_contrat *contrats, const double *spots, int nb, double *prix)
+{
+	if (!contexte || nb < 0 || (nb > 0 && (!contrats || !spots || !prix)))
+		return BS_ERREUR_ARGUMENT;
+	const int n = contexte->nS;
+	const double *S = contexte->S;
+	const double dS = S[1] - S[0];
+	try
+	{
+		for (int k = 0; k < nb; ++k)
+		{
+			if (!contratValide(contrats[k]) || !(spots[k] >= S[0] && spots[k] <= S[n - 1]))
+				return BS_ERREUR_ARGUMENT;
+			double *V = contexte->couche.data();
+			avecSchema(*contexte, contrats[k], [&](const ThetaSchema &schema)
+					   { schema.solveInitiale(V, contexte->travail); });
+			int j = std::min((int)((spots[k] - S[0]) / dS), n - 2);
+			double w = (spots[k] - S[j]) / dS;
+			prix[k] = (1.0 - w) * V[j] + w * V[j + 1];
+		}
+		return BS_OK;
+	}
+	catch (...)
+	{
+		return statutException();
+	}
+}
+
+bs_statut bs_surface(bs_contexte *contexte, const bs_contrat *contrat, double *surface, int ldSurface)
+{
+	if (!contexte || !contrat || !surface || ldSurface < contexte->nS || !contratValide(*contrat))
+		return BS_ERREUR_ARGUMENT;
+	try
+	{
+		for (int m = 0; m < contexte->nt; ++m)
+			contexte->couches[m] = surface + (size_t)m * ldSurface;
+		avecSchema(*contexte, *contrat, [&](const ThetaSchema &schema)
+				   { schema.solveDans(contexte->couches.data(), contexte->travail); });
+		return BS_OK;
+	}
+	catch (...)
+	{
+		return statutException();
+	}
+}
@@ -0,0 +1,162 @@
+/**
+ * @file bs_c.h
+ * @brief Interface C stable du solveur (bibliothèque partagée bs_c), pour l'intégration dans un autre moteur
+ *
+ * Toute la mémoire échangée appartient à l'appelant : grilles, lots de contrats et surfaces
+ * de sortie sont lus et écrits en place, sans copie. Un contexte référence les grilles
+ * (elles doivent lui survivre) et possède la mémoire de travail du theta-schéma, dimensionnée
+ * à sa création : les fonctions de pricing n'allouent plus. Un contexte ne doit être utilisé
+ * que par un thread à la fois ; des contextes distincts peuvent servir en parallèle.
+ *
+ * Les grilles sont uniformes : S[j] = j dS, t[m] = t[0] + m dt, l'échéance des contrats
+ * étant le dernier point t[nt - 1]. La grille des prix part de S = 0, où s'appliquent les
+ * conditions au bord des calls et des puts : une grille tronquée en S[0] > 0 est refusée. Les fonctions renvoient un bs_statut et n'exposent aucune
+ * exception C++.
+ *
+ * Exemple :
+ *
+ *     bs_contexte *ctx;
+ *     bs_contexte_creer(S, nS, t, nt, 0.5, &ctx);
+ *     bs_contrat c = {BS_CALL, 100.0, 0.05, 0.2};
+ *     bs_prix_initiaux(ctx, &c, 1, prix, nS); // prix[j] : prix en S[j] à la date t[0]
+ *     bs_contexte_detruire(ctx);
+ */
+
+#ifndef BS_C_H
+#define BS_C_H
+
+#if defined(_WIN32)
+#if defined(BS_C_EXPORTS)
+#define BS_C_API __declspec(dllexport)
+#else
+#define BS_C_API __declspec(dllimport)
+#endif
+#else
+#define BS_C_API __attribute__((visibility("default")))
+#endif
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+/** Version de l'interface, incrémentée à chaque changement incompatible */
+#define BS_C_VERSION 1
+
+/**
+ * @brief Code de retour des fonctions de l'interface
+ */
+typedef enum bs_statut
+{
+	BS_OK = 0,				/* Succès */
+	BS_ERREUR_ARGUMENT = 1, /* Argument invalide : pointeur nul, grille trop petite, non croissante, non uniforme ou ne partant pas de 0, contrat incohérent */
+	BS_ERREUR_MEMOIRE = 2,	/* Allocation impossible à la création du contexte */
+	BS_ERREUR_INTERNE = 3	/* Erreur inattendue du solveur */
+} bs_statut;
+
+/**
+ * @brief Type de contrat
+ */
+enum
+{
+	BS_CALL = 0,
+	BS_PUT = 1
+};
+
+/**
+ * @struct bs_contrat
+ * @brief Option européenne et marché sous lequel la résoudre
+ */
+typedef struct bs_contrat
+{
+	int type;	  /* BS_CALL ou BS_PUT */
+	double K;	  /* Prix d'exercice, strictement positif */
+	double r;	  /* Taux d'intérêt sans risque */
+	double sigma; /* Volatilité, strictement positive */
+} bs_contrat;
+
+/**
+ * @brief Contexte opaque : grilles de l'appelant et mémoire de travail
+ */
+typedef struct bs_contexte bs_contexte;
+
+/**
+ * @brief Version de l'interface à laquelle la bibliothèque a été compilée
+ * @return BS_C_VERSION
+ */
+BS_C_API int bs_version(void);
+
+/**
+ * @brief Message décrivant un statut
+ * @param statut Code de retour
+ * @return Chaîne statique
+ */
+BS_C_API const char *bs_message(bs_statut statut);
+
+/**
+ * @brief Crée un contexte sur des grilles de l'appelant, qui ne sont pas copiées
+ * @param S Grille uniforme croissante des prix du sous-jacent, nS valeurs, avec S[0] = 0
+ * @param nS Nombre de points en espace, au moins 3
+ * @param t Grille uniforme croissante des temps, nt valeurs
+ * @param nt Nombre de points en temps, au moins 2
+ * @param theta Poids de la partie implicite : 0.5 pour Crank-Nicholson, 1 pour le schéma implicite
+ * @param contexte Contexte créé, à libérer par bs_contexte_detruire
+ * @return BS_OK, BS_ERREUR_ARGUMENT (notamment si un pas d'une grille s'écarte du premier de plus de 1e-6 en
+ *         relatif) ou BS_ERREUR_MEMOIRE
+ */
+BS_C_API bs_statut bs_contexte_creer(const double *S, int nS, const double *t, int nt, double theta,
+									 bs_contexte **contexte);
+
+/**
+ * @brief Libère un contexte (sans effet sur un pointeur nul)
+ * @param contexte Contexte créé par bs_contexte_creer
+ */
+BS_C_API void bs_contexte_detruire(bs_contexte *contexte);
+
+/**
+ * @brief Remplace les nbPas premiers pas depuis l'échéance par deux demi-pas implicites (démarrage de Rannacher)
+ * @param contexte Contexte
+ * @param nbPas Nombre de pas concernés (2 en général), 0 pour désactiver
+ * @return BS_OK ou BS_ERREUR_ARGUMENT
+ */
+BS_C_API bs_statut bs_contexte_rannacher(bs_contexte *contexte, int nbPas);
+
+/**
+ * @brief Prix à la date t[0] d'un lot de contrats, sur toute la grille en S
+ * @param contexte Contexte
+ * @param contrats Lot de nb contrats
+ * @param nb Nombre de contrats
+ * @param prix Sortie : prix[k * ldPrix + j] est le prix du contrat k en S[j]
+ * @param ldPrix Écart entre deux lignes de prix, au moins nS
+ * @return BS_OK, BS_ERREUR_ARGUMENT (les lignes précédant le contrat fautif sont écrites) ou BS_ERREUR_INTERNE
+ */
+BS_C_API bs_statut bs_prix_initiaux(bs_contexte *contexte, const bs_contrat *contrats, int nb, double *prix,
+									int ldPrix);
+
+/**
+ * @brief Prix à la date t[0] d'un lot de contrats, chacun en un spot, par interpolation linéaire sur la grille
+ * @param contexte Contexte
+ * @param contrats Lot de nb contrats
+ * @param spots Spot de chaque contrat, dans [S[0], S[nS - 1]]
+ * @param nb Nombre de contrats
+ * @param prix Sortie : nb prix
+ * @return BS_OK, BS_ERREUR_ARGUMENT ou BS_ERREUR_INTERNE
+ */
+BS_C_API bs_statut bs_prix_spots(bs_contexte *contexte, const bs_contrat *contrats, const double *spots, int nb,
+								 double *prix);
+
+/**
+ * @brief Surface de prix complète d'un contrat, écrite dans la mémoire de l'appelant
+ * @param contexte Contexte
+ * @param contrat Contrat
+ * @param surface Sortie : surface[m * ldSurface + j] est le prix en (t[m], S[j])
+ * @param ldSurface Écart entre deux couches de temps, au moins nS
+ * @return BS_OK, BS_ERREUR_ARGUMENT ou BS_ERREUR_INTERNE
+ */
+BS_C_API bs_statut bs_surface(bs_contexte *contexte, const bs_contrat *contrat, double *surface, int ldSurface);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
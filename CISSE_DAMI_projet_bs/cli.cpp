@@ -0,0 +1,189 @@
+/**
+ * \file cli.cpp
+ * \brief Programme en ligne de commande : prix Call/Put par Crank-Nicholson et implicite, sans interface graphique
+ *
+ * Usage : bs_cli [--K=100] [--T=1] [--r=0.1] [--sigma=0.1] [--S0=100] [--L=300] [--N=1000] [--M=1000]
+ *               [--precision=double|float|mixte] [--tolerance=1e-4]
+ *
+ * En précision float ou mixte, l'écart maximal au calcul double est également affiché.
+ * Avec --tolerance, N, M et L sont choisis automatiquement (dimensionnerGrille) pour
+ * atteindre la tolérance sur le prix en S0, et ne sont plus lus sur la ligne de commande.
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <vector>
+#include "EDP.hpp"
+#include "Option.hpp"
+#include "DifferenceFinie.hpp"
+#include "Dimensionnement.hpp"
+
+/**
+ * \brief Lit la valeur d'une option de la forme --nom=valeur
+ * \return true si l'argument correspond à l'option
+ */
+static bool lireOption(const std::string &arg, const std::string &nom, double &valeur)
+{
+	std::string prefixe = "--" + nom + "=";
+	if (arg.compare(0, prefixe.size(), prefixe) != 0)
+		return false;
+	valeur = std::atof(arg.c_str() + prefixe.size());
+	return true;
+}
+
+/**
+ * \brief Convertit une matrice de prix en double
+ */
+template <typename Real>
+static std::vector<std::vector<double>> versDouble(const std::vector<std::vector<Real>> &V)
+{
+	std::vector<std::vector<double>> W(V.size());
+	for (size_t m = 0; m < V.size(); ++m)
+		W[m].assign(V[m].begin(), V[m].end());
+	return W;
+}
+
+/**
+ * \brief Résout avec le schéma donné dans la précision demandée
+ */
+template <typename Schema>
+static std::vector<std::vector<double>> resoudre(const Schema &schema, const std::string &precision)
+{
+	if (precision == "float")
+		return versDouble(schema.template solveAs<float>());
+	if (precision == "mixte")
+		return versDouble(schema.template solveAs<float, double>());
+	return schema.template solveAs<double>();
+}
+
+/**
+ * \brief Écart maximal entre deux couches de prix
+ */
+static double ecartMax(const std::vector<double> &a, const std::vector<double> &b)
+{
+	double e = 0.0;
+	for (size_t j = 0; j < a.size(); ++j)
+		e = std::max(e, std::abs(a[j] - b[j]));
+	return e;
+}
+
+/**
+ * \brief Prix interpolé linéairement au point S sur la grille uniforme
+ */
+static double prixEn(const std::vector<double> &grille, const std::vector<double> &V, double S)
+{
+	double dS = grille[1] - grille[0];
+	int j = std::min(std::max((int)((S - grille[0]) / dS), 0), (int)grille.size() - 2);
+	double w = (S - grille[j]) / dS;
+	return (1.0 - w) * V[j] + w * V[j + 1];
+}
+
+/**
+ * \brief Point d'entrée du programme en ligne de commande
+ * \return 0 si exécution normale, 1 si un argument est invalide, 3 si la tolérance demandée n'est pas atteinte
+ */
+int main(int argc, char **argv)
+{
+	double T = 1.0, r = 0.1, sigma = 0.1, K = 100.0, S0 = 100.0, L = 300.0;
+	double N = 1000, M = 1000;
+	double tolerance = 0.0;
+	std::string precision = "double";
+
+	for (int k = 1; k < argc; ++k)
+	{
+		std::string arg = argv[k];
+		if (arg.compare(0, 12, "--precision=") == 0)
+		{
+			precision = arg.substr(12);
+			if (precision != "double" && precision != "float" && precision != "mixte")
+			{
+				std::cerr << "Précision inconnue : " << precision << "\n";
+				return 1;
+			}
+		}
+		else if (!(lireOption(arg, "K", K) || lireOption(arg, "T", T) || lireOption(arg, "r", r) ||
+			  lireOption(arg, "sigma", sigma) || lireOption(arg, "S0", S0) || lireOption(arg, "L", L) ||
+			  lireOption(arg, "N", N) || lireOption(arg, "M", M) || lireOption(arg, "tolerance", tolerance)))
+		{
+			std::cerr << "Option inconnue : " << arg << "\n";
+			return 1;
+		}
+	}
+
+	if (tolerance > 0.0)
+	{
+		// Grille automatique, dimensionnée séparément pour le Call et le Put
+		Actif actif(S0, r, sigma);
+		Call callOption(K, T);
+		Put putOption(K, T);
+		Dimensionnement dimCall = dimensionnerGrille(callOption, actif, tolerance);
+		Dimensionnement dimPut = dimensionnerGrille(putOption, actif, tolerance);
+		std::cout << "Call (S0 = " << S0 << ") : CN = " << dimCall.valeur << " (N = " << dimCall.N << ", M = "
+				  << dimCall.M << ", L = " << dimCall.Smax << ", erreur estimee " << dimCall.erreur << ")\n";
+		std::cout << "Put  (S0 = " << S0 << ") : CN = " << dimPut.valeur << " (N = " << dimPut.N << ", M = "
+				  << dimPut.M << ", L = " << dimPut.Smax << ", erreur estimee " << dimPut.erreur << ")\n";
+		if (!dimCall.atteinte || !dimPut.atteinte)
+		{
+			std::cerr << "Attention : tolerance " << tolerance << " non atteinte (taille maximale ou raffinements epuises)\n";
+			return 3;
+		}
+		return 0;
+	}
+
+	int n = (int)N, m = (int)M;
+
+	// Grilles de temps et de prix
+	std::vector<double> t(m + 1);
+	for (int i = 0; i <= m; ++i)
+		t[i] = i * T / m;
+
+	std::vector<double> S(n + 1);
+	for (int j = 0; j <= n; ++j)
+		S[j] = j * L / n;
+
+	Actif actif(S0, r, sigma);
+	Call callOption(K, T);
+	Put putOption(K, T);
+
+	EDPComplete edpCall(callOption, actif), edpPut(putOption, actif);
+	EDPReduite edpCallImp(callOption, actif), edpPutImp(putOption, actif);
+
+	Crank_Nicholson CN_Call(edpCall, n + 1, m + 1, S, t);
+	Crank_Nicholson CN_Put(edpPut, n + 1, m + 1, S, t);
+	Implicite Imp_Call(edpCallImp, n + 1, m + 1, S, t);
+	Implicite Imp_Put(edpPutImp, n + 1, m + 1, S, t);
+
+	auto V_call_CN = resoudre(CN_Call, precision);
+	auto V_put_CN = resoudre(CN_Put, precision);
+	auto V_call_imp = resoudre(Imp_Call, precision);
+	auto V_put_imp = resoudre(Imp_Put, precision);
+
+	double max_err_call = 0.0, max_err_put = 0.0;
+	for (int j = 0; j <= n; ++j)
+	{
+		max_err_call = std::max(max_err_call, std::abs(V_call_CN[0][j] - V_call_imp[0][j]));
+		max_err_put = std::max(max_err_put, std::abs(V_put_CN[0][j] - V_put_imp[0][j]));
+	}
+
+	std::cout << "Call (S0 = " << S0 << ") : CN = " << prixEn(S, V_call_CN[0], S0)
+			  << ", implicite = " << prixEn(S, V_call_imp[0], S0) << "\n";
+	std::cout << "Put  (S0 = " << S0 << ") : CN = " << prixEn(S, V_put_CN[0], S0)
+			  << ", implicite = " << prixEn(S, V_put_imp[0], S0) << "\n";
+	std::cout << "Erreur max Call : " << max_err_call << "\n";
+	std::cout << "Erreur max Put  : " << max_err_put << "\n";
+
+	if (precision != "double")
+	{
+		// Écart au calcul de référence en double précision
+		std::cout << "Ecart a la double precision (" << precision << ") : Call CN = "
+				  << ecartMax(V_call_CN[0], CN_Call.solve()[0])
+				  << ", Put CN = " << ecartMax(V_put_CN[0], CN_Put.solve()[0])
+				  << ", Call implicite = " << ecartMax(V_call_imp[0], Imp_Call.solve()[0])
+				  << ", Put implicite = " << ecartMax(V_put_imp[0], Imp_Put.solve()[0]) << "\n";
+	}
+
+	return 0;
+}
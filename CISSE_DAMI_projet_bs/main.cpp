@@ -28,7 +28,7 @@
 #include <cmath>
 #include "EDP.hpp"
 #include "Option.hpp"
-#include "Sdl.hpp"
+#include "sdl.hpp"
 #include "DifferenceFinie.hpp"
 
 /**
@@ -113,42 +113,61 @@ int main()
 	SDL_Color rouge = {255, 0, 0, 255}, bleu = {0, 0, 255, 255}, vert = {0, 150, 0, 255};
 	double maxY_Call = L, maxY_Put = K * 1.1;
 
+	// Boucle événementielle : les données ne changent pas, une fenêtre n'est redessinée
+	// qu'à son affichage, lorsqu'elle est exposée ou redimensionnée ; entre deux événements
+	// le programme dort dans SDL_WaitEvent
+	Sdl *fenetres[4] = {&winCallPrix, &winCallErr, &winPutPrix, &winPutErr};
+	bool aRedessiner[4] = {true, true, true, true};
 	bool keepRunning = true;
 	while (keepRunning)
 	{
-		// 1. Gestion des événements (pour toutes les fenêtres)
+		// 1. Rendu des fenêtres invalidées
+		if (aRedessiner[0])
+		{
+			winCallPrix.clear();
+			winCallPrix.drawCurve(S, V_call_CN[0], L, maxY_Call, rouge);
+			winCallPrix.drawCurve(S, V_call_imp[0], L, maxY_Call, bleu);
+			winCallPrix.present();
+		}
+		if (aRedessiner[1])
+		{
+			winCallErr.clear();
+			winCallErr.drawCurve(S, erreur_call, L, max_err_call, vert);
+			winCallErr.present();
+		}
+		if (aRedessiner[2])
+		{
+			winPutPrix.clear();
+			winPutPrix.drawCurve(S, V_put_CN[0], L, maxY_Put, rouge);
+			winPutPrix.drawCurve(S, V_put_imp[0], L, maxY_Put, bleu);
+			winPutPrix.present();
+		}
+		if (aRedessiner[3])
+		{
+			winPutErr.clear();
+			winPutErr.drawCurve(S, erreur_put, L, max_err_put, vert);
+			winPutErr.present();
+		}
+		for (bool &b : aRedessiner)
+			b = false;
+
+		// 2. Attente du prochain événement, puis traitement de tous ceux en file
 		SDL_Event e;
-		while (SDL_PollEvent(&e))
+		if (!SDL_WaitEvent(&e))
+			break;
+		do
 		{
 			// Si on ferme n'importe quelle fenêtre ou qu'on appuie sur Echap
 			if (e.type == SDL_QUIT || (e.type == SDL_KEYDOWN && e.key.keysym.sym == SDLK_ESCAPE))
 				keepRunning = false;
-		}
-
-		// 2. Rendu de la fenêtre Call Prix
-		winCallPrix.clear();
-		winCallPrix.drawCurve(S, V_call_CN[0], L, maxY_Call, rouge);
-		winCallPrix.drawCurve(S, V_call_imp[0], L, maxY_Call, bleu);
-		winCallPrix.present();
-
-		// 3. Rendu de la fenêtre Call Erreur
-		winCallErr.clear();
-		winCallErr.drawCurve(S, erreur_call, L, max_err_call, vert);
-		winCallErr.present();
-
-		// 4. Rendu de la fenêtre Put Prix
-		winPutPrix.clear();
-		winPutPrix.drawCurve(S, V_put_CN[0], L, maxY_Put, rouge);
-		winPutPrix.drawCurve(S, V_put_imp[0], L, maxY_Put, bleu);
-		winPutPrix.present();
-
-		// 5. Rendu de la fenêtre Put Erreur
-		winPutErr.clear();
-		winPutErr.drawCurve(S, erreur_put, L, max_err_put, vert);
-		winPutErr.present();
-
-		// Pause
-		SDL_Delay(10);
+			for (int k = 0; k < 4; ++k)
+			{
+				if (fenetres[k]->estFermee(e))
+					keepRunning = false;
+				if (fenetres[k]->doitRedessiner(e))
+					aRedessiner[k] = true;
+			}
+		} while (SDL_PollEvent(&e));
 	}
 
 	return 0;
@@ -4,6 +4,7 @@
  */
 
 #include "sdl.hpp"
+#include <algorithm>
 #include <iostream>
 
 /**
@@ -28,7 +29,7 @@ Sdl::Sdl(int height, int width, std::string titre)
 		SDL_WINDOWPOS_CENTERED,
 		width_,
 		height_,
-		SDL_WINDOW_SHOWN);
+		SDL_WINDOW_SHOWN | SDL_WINDOW_RESIZABLE);
 
 	// Crétion du renderer
 	renderer_ = SDL_CreateRenderer(window_, -1, SDL_RENDERER_ACCELERATED);
@@ -67,18 +68,55 @@ bool Sdl::isRunning()
 	return running_;
 }
 
+/**
+ * @brief Indique si un événement demande de redessiner cette fenêtre (exposition, redimensionnement)
+ * @param e événement reçu
+ * @return true si la fenêtre doit être redessinée
+ */
+bool Sdl::doitRedessiner(const SDL_Event &e) const
+{
+	if (e.type != SDL_WINDOWEVENT || e.window.windowID != SDL_GetWindowID(window_))
+	{
+		return false;
+	}
+	switch (e.window.event)
+	{
+	case SDL_WINDOWEVENT_SHOWN:
+	case SDL_WINDOWEVENT_EXPOSED:
+	case SDL_WINDOWEVENT_SIZE_CHANGED:
+	case SDL_WINDOWEVENT_RESTORED:
+		return true;
+	default:
+		return false;
+	}
+}
+
+/**
+ * @brief Indique si un événement ferme cette fenêtre
+ * @param e événement reçu
+ * @return true si la fenêtre est fermée
+ */
+bool Sdl::estFermee(const SDL_Event &e) const
+{
+	return e.type == SDL_WINDOWEVENT && e.window.event == SDL_WINDOWEVENT_CLOSE &&
+		   e.window.windowID == SDL_GetWindowID(window_);
+}
+
 /**
  * @brief nettoyage de la fenêtre
  */
 void Sdl::clear()
 {
+	// Taille courante de la zone de rendu, qui suit les redimensionnements
+	SDL_GetRendererOutputSize(renderer_, &width_, &height_);
+
 	SDL_SetRenderDrawColor(renderer_, 255, 255, 255, 255);
 	SDL_RenderClear(renderer_);
 }
 
 /**
  * @brief dessine la courbe sur la fenêtre
- * @param x prix de l'actif sous-jacent
+ * @param x prix de l'actif sous-jacent, croissants
  * @param y valeurs de l'option
  * @param x_max prix maximum de l'actif
  * @param y_max valeur maximum de l'option
@@ -107,7 +145,7 @@ void Sdl::drawCurve(const std::vector<double> &x, const std::vector<double> &y,
 	// Axe X
 	SDL_RenderDrawLine(renderer_, margin, height_ - margin, width_ - margin, height_ - margin);
 
-	// Graduation de la courbe
+	// Graduation des axes
 	for (int i = 0; i <= 5; i++)
 	{
 		int x_grad = margin + (i * draw_width / 5);
@@ -115,30 +153,62 @@ void Sdl::drawCurve(const std::vector<double> &x, const std::vector<double> &y,
 
 		int y_grad = (height_ - margin) - (i * draw_height / 5);
 		SDL_RenderDrawLine(renderer_, margin - 5, y_grad, margin, y_grad);
+	}
 
-		// Tracé de la courbe
-		SDL_SetRenderDrawColor(renderer_, color.r, color.g, color.b, color.a); // configuration de la couleur
-		for (size_t i = 0; i < x.size() - 1; ++i)
+	// Réduction de la courbe à la résolution de l'écran : par colonne de pixels,
+	// premier point, minimum, maximum et dernier point
+	points_.clear();
+	auto ajouter = [this](int px, int py)
+	{
+		if (points_.empty() || points_.back().x != px || points_.back().y != py)
 		{
-			// Calcul du point 1
-			double ratio_x1 = x[i] / x_max;
-			double ratio_y1 = y[i] / y_max;
-
-			// projection
-			int pixel_x1 = margin + (int)(ratio_x1 * draw_width);
-
-			// Inversion Y
-			int pixel_y1 = (height_ - margin) - (int)(ratio_y1 * draw_height);
+			points_.push_back({px, py});
+		}
+	};
 
-			// Calcul du point 2
-			double ratio_x2 = x[i + 1] / x_max;
-			double ratio_y2 = y[i + 1] / y_max;
+	size_t n = std::min(x.size(), y.size());
+	int colonne = 0, premier = 0, dernier = 0, haut = 0, bas = 0;
+	bool haut_avant_bas = true; // ordre d'apparition du minimum et du maximum de la colonne
+	for (size_t i = 0; i < n; ++i)
+	{
+		// projection, avec inversion de l'axe Y
+		int pixel_x = margin + (int)(x[i] / x_max * draw_width);
+		int pixel_y = (height_ - margin) - (int)(y[i] / y_max * draw_height);
 
-			int pixel_x2 = margin + (int)(ratio_x2 * draw_width);
-			int pixel_y2 = (height_ - margin) - (int)(ratio_y2 * draw_height);
+		if (i > 0 && pixel_x == colonne)
+		{
+			if (pixel_y < haut)
+			{
+				haut = pixel_y;
+				haut_avant_bas = false;
+			}
+			if (pixel_y > bas)
+			{
+				bas = pixel_y;
+				haut_avant_bas = true;
+			}
+			dernier = pixel_y;
+			continue;
+		}
 
-			// Tracé du segment
-			SDL_RenderDrawLine(renderer_, pixel_x1, pixel_y1, pixel_x2, pixel_y2);
+		// Colonne terminée : ses extrêmes dans leur ordre d'apparition
+		if (i > 0)
+		{
+			ajouter(colonne, premier);
+			ajouter(colonne, haut_avant_bas ? haut : bas);
+			ajouter(colonne, haut_avant_bas ? bas : haut);
+			ajouter(colonne, dernier);
 		}
+		colonne = pixel_x;
+		premier = dernier = haut = bas = pixel_y;
+		haut_avant_bas = true;
 	}
-}
\ No newline at end of file
+	ajouter(colonne, premier);
+	ajouter(colonne, haut_avant_bas ? haut : bas);
+	ajouter(colonne, haut_avant_bas ? bas : haut);
+	ajouter(colonne, dernier);
+
+	// Tracé de la courbe en un appel
+	SDL_SetRenderDrawColor(renderer_, color.r, color.g, color.b, color.a); // configuration de la couleur
+	SDL_RenderDrawLines(renderer_, points_.data(), (int)points_.size());
+}
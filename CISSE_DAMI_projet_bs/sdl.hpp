@@ -23,6 +23,7 @@ protected:
 	int width_;
 	bool running_;
 	std::string titre_;
+	std::vector<SDL_Point> points_; // Polyligne sous-échantillonnée, réutilisée d'un tracé à l'autre
 
 public:
 	/**
@@ -51,8 +52,30 @@ public:
 	 */
 	bool isRunning();
 
+	/**
+	 * @brief Indique si un événement demande de redessiner cette fenêtre (exposition, redimensionnement)
+	 * @param e événement reçu
+	 * @return true si la fenêtre doit être redessinée
+	 */
+	bool doitRedessiner(const SDL_Event &e) const;
+
+	/**
+	 * @brief Indique si un événement ferme cette fenêtre
+	 * @param e événement reçu
+	 * @return true si la fenêtre est fermée
+	 */
+	bool estFermee(const SDL_Event &e) const;
+
 	/**
 	 * @brief dessine la courbe sur la fenêtre
+	 *
+	 * Les axes et graduations sont tracés une fois, puis la courbe en un seul appel
+	 * SDL_RenderDrawLines. Elle est réduite à la résolution de l'écran : les points qui
+	 * tombent dans une même colonne de pixels sont remplacés par le premier, le minimum, le
+	 * maximum et le dernier d'entre eux, ce qui conserve l'enveloppe verticale de la courbe
+	 * et borne le tracé à quatre points par colonne, quelle que soit la taille de la grille.
+	 * Les abscisses doivent être croissantes.
+	 *
 	 * @param x prix de l'actif sous-jacent
 	 * @param y valeurs de l'option
 	 * @param x_max prix maximum de l'actif
@@ -0,0 +1,72 @@
+/**
+ * @file Protocole.hpp
+ * @brief Protocole binaire du service de pricing sur socket Unix (bs_serveur, bs_client)
+ *
+ * Le flux est une suite de messages de taille fixe, dans l'ordre des octets de la machine :
+ * client et serveur tournent sur le même hôte. Chaque RequetePrix reçoit exactement une
+ * ReponsePrix portant le même identifiant ; les réponses peuvent arriver dans le désordre,
+ * le client peut donc garder plusieurs requêtes en vol sur une même connexion.
+ */
+
+#ifndef PROTOCOLE_HPP
+#define PROTOCOLE_HPP
+
+#include <cstdint>
+
+/**
+ * @brief Nature d'une requête
+ */
+enum TypeRequete : uint8_t
+{
+	RequeteCall = 0, // Prix d'un call européen
+	RequetePut = 1,	 // Prix d'un put européen
+	RequeteArret = 255 // Arrêt du serveur une fois les requêtes en cours servies, sans réponse
+};
+
+/**
+ * @brief Statut d'une réponse
+ */
+enum StatutReponse : int32_t
+{
+	ReponseOk = 0,		  // prix_ est renseigné
+	ReponseInvalide = 1,  // Paramètres incohérents (pas positifs, grille trop petite...)
+	ReponseHorsGrille = 2 // Spot hors de [0, Smax]
+};
+
+/**
+ * @struct RequetePrix
+ * @brief Demande de prix d'une option européenne sur une grille de Crank-Nicholson
+ *
+ * Les requêtes de même contrat et de même grille (type_, K_, T_, Smax_, N_, M_) forment un
+ * lot, résolu une fois par couple (sigma_, r_) ; S_ ne fait que choisir le point lu.
+ */
+struct RequetePrix
+{
+	uint32_t id_;		  // Identifiant, recopié dans la réponse
+	uint8_t type_;		  // TypeRequete
+	uint8_t reserve_[3];  // Alignement, à zéro
+	double S_;			  // Prix du sous-jacent
+	double K_;			  // Prix d'exercice
+	double T_;			  // Maturité
+	double r_;			  // Taux d'intérêt sans risque
+	double sigma_;		  // Volatilité
+	double Smax_;		  // Borne supérieure de la grille en S
+	uint32_t N_;		  // Nombre d'intervalles en S
+	uint32_t M_;		  // Nombre de pas de temps
+};
+
+/**
+ * @struct ReponsePrix
+ * @brief Réponse à une RequetePrix
+ */
+struct ReponsePrix
+{
+	uint32_t id_;	 // Identifiant de la requête
+	int32_t statut_; // StatutReponse
+	double prix_;	 // Prix, si statut_ vaut ReponseOk
+};
+
+static_assert(sizeof(RequetePrix) == 64, "RequetePrix doit faire 64 octets");
+static_assert(sizeof(ReponsePrix) == 16, "ReponsePrix doit faire 16 octets");
+
+#endif
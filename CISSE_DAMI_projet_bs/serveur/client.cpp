@@ -0,0 +1,281 @@
+/**
+ * @file client.cpp
+ * @brief Client local de bs_serveur : génère une charge de requêtes et mesure débit et latence
+ *
+ * Le client garde --en-vol requêtes en cours sur une connexion et mesure, pour chacune, le
+ * temps aller-retour entre l'écriture de la requête et la lecture de sa réponse. Les
+ * requêtes portent sur 3 prix d'exercice, call et put, 3 volatilités et 2 taux, avec un spot
+ * tiré uniformément : une charge où les lots du serveur partagent réellement leurs résolutions.
+ *
+ * Avec --verifier, les --verifier premières réponses sont recalculées localement par le même
+ * moteur (MoteurScenarios) et l'écart maximal est affiché ; avec --arret, le serveur est
+ * arrêté à la fin et affiche son propre bilan. Avec --invalide, la requête du milieu porte un
+ * strike NaN : elle doit être seule à recevoir ReponseInvalide, sans contaminer les requêtes
+ * valides de son lot. Tout tourne hors ligne, sur la même machine :
+ *
+ *     ./bs_serveur --socket=/tmp/bs.sock &
+ *     ./bs_client --socket=/tmp/bs.sock --requetes=100000 --verifier=100 --arret
+ *
+ * Code de retour : 0 si tout est conforme, 2 si une requête valide est en erreur ou si la
+ * requête invalide n'est pas rejetée, 3 si un prix vérifié s'écarte du calcul local.
+ *
+ * Usage : bs_client [--socket=/tmp/bs_serveur.sock] [--requetes=100000] [--en-vol=256]
+ *                   [--N=200] [--M=200] [--verifier=0] [--invalide] [--arret]
+ */
+
+#include "Protocole.hpp"
+#include "../Option.hpp"
+#include "../Scenarios.hpp"
+
+#include <algorithm>
+#include <cerrno>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <poll.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+namespace
+{
+
+typedef std::chrono::steady_clock Horloge;
+
+/**
+ * @brief Lit la valeur d'une option de la forme --nom=valeur
+ * @return true si l'argument correspond à l'option
+ */
+bool lireOption(const std::string &arg, const std::string &nom, std::string &valeur)
+{
+	std::string prefixe = "--" + nom + "=";
+	if (arg.compare(0, prefixe.size(), prefixe) != 0)
+		return false;
+	valeur = arg.substr(prefixe.size());
+	return true;
+}
+
+/**
+ * @brief Écrit tout le tampon, en attendant si la socket est pleine
+ * @return false si la connexion est rompue
+ */
+bool ecrireTout(int fd, const char *donnees, size_t taille)
+{
+	while (taille > 0)
+	{
+		ssize_t k = send(fd, donnees, taille, MSG_NOSIGNAL);
+		if (k < 0 && errno == EINTR)
+			continue;
+		if (k <= 0)
+			return false;
+		donnees += k;
+		taille -= (size_t)k;
+	}
+	return true;
+}
+
+/**
+ * @brief Quantile q d'un échantillon trié
+ */
+double quantile(const std::vector<double> &trie, double q)
+{
+	return trie[std::min(trie.size() - 1, (size_t)(q * trie.size()))];
+}
+
+/**
+ * @brief Prix de la requête recalculé localement, sur la même grille que le serveur
+ */
+double prixLocal(const RequetePrix &q)
+{
+	std::vector<double> S(q.N_ + 1), t(q.M_ + 1);
+	for (uint32_t j = 0; j <= q.N_; ++j)
+		S[j] = j * q.Smax_ / q.N_;
+	for (uint32_t m = 0; m <= q.M_; ++m)
+		t[m] = m * q.T_ / q.M_;
+	Call call(q.K_, q.T_);
+	Put put(q.K_, q.T_);
+	Option &option = q.type_ == RequeteCall ? (Option &)call : (Option &)put;
+	MoteurScenarios moteur(option, Actif(q.K_), S, t);
+	return moteur.evaluer({{q.S_, q.sigma_, q.r_}})[0];
+}
+
+} // namespace
+
+int main(int argc, char **argv)
+{
+	std::string chemin = "/tmp/bs_serveur.sock";
+	long nbRequetes = 100000;
+	int enVolMax = 256, verifier = 0;
+	uint32_t N = 200, M = 200;
+	bool arreter = false, invalide = false;
+	for (int i = 1; i < argc; ++i)
+	{
+		std::string arg = argv[i], valeur;
+		if (lireOption(arg, "socket", valeur))
+			chemin = valeur;
+		else if (lireOption(arg, "requetes", valeur))
+			nbRequetes = std::max(1L, std::atol(valeur.c_str()));
+		else if (lireOption(arg, "en-vol", valeur))
+			enVolMax = std::max(1, std::atoi(valeur.c_str()));
+		else if (lireOption(arg, "N", valeur))
+			N = (uint32_t)std::atoi(valeur.c_str());
+		else if (lireOption(arg, "M", valeur))
+			M = (uint32_t)std::atoi(valeur.c_str());
+		else if (lireOption(arg, "verifier", valeur))
+			verifier = std::atoi(valeur.c_str());
+		else if (arg == "--arret")
+			arreter = true;
+		else if (arg == "--invalide")
+			invalide = true;
+		else
+		{
+			std::cerr << "Option inconnue : " << arg << "\n";
+			return 1;
+		}
+	}
+
+	// Charge déterministe : contrats et marchés en petit nombre, spots tirés au hasard
+	const double strikes[] = {90.0, 100.0, 110.0};
+	const double sigmas[] = {0.15, 0.2, 0.25};
+	const double taux[] = {0.02, 0.05};
+	std::mt19937 generateur(42);
+	std::uniform_int_distribution<int> choix(0, 1 << 20);
+	std::uniform_real_distribution<double> spot(50.0, 150.0);
+	std::vector<RequetePrix> requetes(nbRequetes);
+	for (long k = 0; k < nbRequetes; ++k)
+	{
+		RequetePrix &q = requetes[k];
+		std::memset(&q, 0, sizeof(q));
+		q.id_ = (uint32_t)k;
+		q.type_ = choix(generateur) % 2 ? RequetePut : RequeteCall;
+		q.K_ = strikes[choix(generateur) % 3];
+		q.T_ = 1.0;
+		q.sigma_ = sigmas[choix(generateur) % 3];
+		q.r_ = taux[choix(generateur) % 2];
+		q.S_ = spot(generateur);
+		q.Smax_ = 300.0;
+		q.N_ = N;
+		q.M_ = M;
+	}
+	const long idInvalide = invalide ? nbRequetes / 2 : -1;
+	if (invalide)
+		requetes[idInvalide].K_ = std::nan("");
+
+	sockaddr_un adresse;
+	std::memset(&adresse, 0, sizeof(adresse));
+	adresse.sun_family = AF_UNIX;
+	if (chemin.size() >= sizeof(adresse.sun_path))
+	{
+		std::cerr << "Chemin de socket trop long : " << chemin << "\n";
+		return 1;
+	}
+	std::strcpy(adresse.sun_path, chemin.c_str());
+	int fd = socket(AF_UNIX, SOCK_STREAM, 0);
+	if (fd < 0 || connect(fd, (sockaddr *)&adresse, sizeof(adresse)) < 0)
+	{
+		std::perror("bs_client : connexion");
+		return 1;
+	}
+
+	// Envoi par paquets pour garder enVolMax requêtes en cours, lecture des réponses au fil de l'eau
+	std::vector<Horloge::time_point> envoi(nbRequetes);
+	std::vector<double> latences;
+	std::vector<ReponsePrix> reponses(nbRequetes);
+	latences.reserve(nbRequetes);
+	std::string tampon;
+	long envoyees = 0, recues = 0, erreurs = 0;
+	bool rejetee = false; // Requête invalide rejetée par le serveur
+	Horloge::time_point debut = Horloge::now();
+	while (recues < nbRequetes)
+	{
+		long paquet = std::min<long>(enVolMax - (envoyees - recues), nbRequetes - envoyees);
+		if (paquet > 0)
+		{
+			Horloge::time_point maintenant = Horloge::now();
+			for (long k = envoyees; k < envoyees + paquet; ++k)
+				envoi[k] = maintenant;
+			if (!ecrireTout(fd, (const char *)&requetes[envoyees], paquet * sizeof(RequetePrix)))
+			{
+				std::perror("bs_client : envoi");
+				return 1;
+			}
+			envoyees += paquet;
+		}
+
+		char lus[1 << 16];
+		ssize_t k = recv(fd, lus, sizeof(lus), 0);
+		if (k < 0 && errno == EINTR)
+			continue;
+		if (k <= 0)
+		{
+			std::cerr << "bs_client : connexion fermée par le serveur\n";
+			return 1;
+		}
+		Horloge::time_point maintenant = Horloge::now();
+		tampon.append(lus, (size_t)k);
+		size_t lu = 0;
+		for (; lu + sizeof(ReponsePrix) <= tampon.size(); lu += sizeof(ReponsePrix))
+		{
+			ReponsePrix r;
+			std::memcpy(&r, tampon.data() + lu, sizeof(r));
+			if (r.id_ >= (uint32_t)nbRequetes)
+				continue;
+			reponses[r.id_] = r;
+			latences.push_back(std::chrono::duration<double, std::micro>(maintenant - envoi[r.id_]).count());
+			if ((long)r.id_ == idInvalide)
+				rejetee = r.statut_ == ReponseInvalide;
+			else
+				erreurs += r.statut_ != ReponseOk;
+			++recues;
+		}
+		tampon.erase(0, lu);
+	}
+	double duree = std::chrono::duration<double>(Horloge::now() - debut).count();
+
+	if (arreter)
+	{
+		RequetePrix arret;
+		std::memset(&arret, 0, sizeof(arret));
+		arret.type_ = RequeteArret;
+		ecrireTout(fd, (const char *)&arret, sizeof(arret));
+	}
+	close(fd);
+
+	std::sort(latences.begin(), latences.end());
+	std::cout << "bs_client : " << nbRequetes << " requetes (" << erreurs << " en erreur), " << enVolMax
+			  << " en vol, grille " << N << " x " << M << "\n"
+			  << std::fixed << std::setprecision(0) << "  debit : " << nbRequetes / duree << " requetes/s\n"
+			  << std::setprecision(1) << "  latence aller-retour (us) : p50 " << quantile(latences, 0.5) << ", p90 "
+			  << quantile(latences, 0.9) << ", p99 " << quantile(latences, 0.99) << ", p99.9 "
+			  << quantile(latences, 0.999) << ", max " << latences.back() << "\n";
+
+	if (invalide)
+		std::cout << "  requete invalide : " << (rejetee ? "rejetee" : "NON rejetee") << "\n";
+	if (erreurs > 0 || (invalide && !rejetee))
+		return 2;
+
+	if (verifier > 0)
+	{
+		// Même moteur et même grille que le serveur : l'écart doit être nul aux arrondis près
+		double ecart = 0.0;
+		int nb = (int)std::min<long>(verifier, nbRequetes);
+		for (int k = 0; k < nb; ++k)
+		{
+			if (k != idInvalide)
+				ecart = std::max(ecart, std::abs(reponses[k].prix_ - prixLocal(requetes[k])));
+		}
+		std::cout << std::scientific << std::setprecision(2) << "  verification : " << nb
+				  << " prix recalcules localement, ecart max " << ecart << "\n";
+		if (!(ecart <= 1e-9))
+			return 3;
+	}
+	return 0;
+}
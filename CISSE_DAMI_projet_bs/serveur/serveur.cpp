@@ -0,0 +1,681 @@
+/**
+ * @file serveur.cpp
+ * @brief Service de pricing asynchrone sur socket Unix, qui regroupe les requêtes en micro-lots
+ *
+ * Un thread d'entrées-sorties (poll) lit les RequetePrix de toutes les connexions et les met
+ * en attente. Les requêtes en attente sont regroupées par contrat et grille (type, K, T, Smax,
+ * N, M) et chaque groupe est confié comme un lot à un pool de threads solveurs : un lot ne
+ * coûte qu'une résolution de Crank-Nicholson par couple (sigma, r) distinct (MoteurScenarios),
+ * quel que soit le nombre de spots demandés. Chaque solveur garde ses moteurs (option, grilles)
+ * d'un lot à l'autre.
+ *
+ * Le regroupement est adaptatif : tant que tous les solveurs sont occupés, les requêtes
+ * s'accumulent et partent ensemble dès qu'un solveur se libère ; à vide, une requête part
+ * au tour de boucle suivant. --fenetre-us impose en plus un âge minimal au lot le plus
+ * ancien (résolution de poll : la milliseconde), --lot-max force l'envoi au-delà d'une taille.
+ *
+ * À l'arrêt (requête RequeteArret ou SIGINT/SIGTERM), les requêtes en cours sont servies puis
+ * le débit et la latence côté serveur (de la lecture de la requête à la mise en file de la
+ * réponse) sont affichés.
+ *
+ * Usage : bs_serveur [--socket=/tmp/bs_serveur.sock] [--threads=0] [--fenetre-us=0] [--lot-max=4096]
+ */
+
+#include "Protocole.hpp"
+#include "../Option.hpp"
+#include "../Scenarios.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <chrono>
+#include <condition_variable>
+#include <csignal>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <cmath>
+#include <deque>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <fcntl.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+namespace
+{
+
+typedef std::chrono::steady_clock Horloge;
+
+/**
+ * @brief Positionné par SIGINT et SIGTERM
+ */
+volatile std::sig_atomic_t arretDemande = 0;
+
+void surSignal(int)
+{
+	arretDemande = 1;
+}
+
+/**
+ * @struct Entree
+ * @brief Requête reçue, en attente ou en cours de traitement
+ */
+struct Entree
+{
+	uint64_t connexion;		  // Connexion d'origine
+	RequetePrix requete;	  // Requête telle que reçue
+	Horloge::time_point recu; // Instant de lecture
+};
+
+/**
+ * @struct CleLot
+ * @brief Contrat et grille partagés par les requêtes d'un même lot
+ */
+struct CleLot
+{
+	uint8_t type;
+	double K, T, Smax;
+	uint32_t N, M;
+
+	/**
+	 * @brief Vrai si le contrat et la grille sont utilisables ; une clé invalide (NaN en
+	 * particulier) ne doit jamais entrer dans une std::map, dont elle casserait l'ordre
+	 */
+	bool valide() const
+	{
+		return (type == RequeteCall || type == RequetePut) && K > 0.0 && T > 0.0 && Smax > 0.0 && std::isfinite(K) &&
+			   std::isfinite(T) && std::isfinite(Smax) && N >= 3 && N <= (1u << 16) && M >= 1 && M <= (1u << 16);
+	}
+
+	bool operator<(const CleLot &o) const
+	{
+		if (type != o.type)
+			return type < o.type;
+		if (K != o.K)
+			return K < o.K;
+		if (T != o.T)
+			return T < o.T;
+		if (Smax != o.Smax)
+			return Smax < o.Smax;
+		if (N != o.N)
+			return N < o.N;
+		return M < o.M;
+	}
+};
+
+/**
+ * @struct Lot
+ * @brief Requêtes de même contrat et de même grille, traitées par un seul solveur
+ */
+struct Lot
+{
+	CleLot cle;
+	std::vector<Entree> entrees;
+};
+
+/**
+ * @struct Resultat
+ * @brief Réponse prête à être écrite sur sa connexion
+ */
+struct Resultat
+{
+	uint64_t connexion;
+	ReponsePrix reponse;
+	float latence; // Microsecondes, de la lecture à la mise en file
+};
+
+/**
+ * @struct SolveurChaud
+ * @brief Option, grilles et moteur de scénarios conservés par un solveur entre deux lots
+ */
+struct SolveurChaud
+{
+	std::unique_ptr<Option> option;
+	std::unique_ptr<MoteurScenarios> moteur;
+};
+
+/**
+ * @class PoolSolveurs
+ * @brief Threads solveurs alimentés par une file de lots ; les résultats reviennent au thread
+ * d'entrées-sorties par une file protégée et un octet écrit sur un tube de réveil
+ */
+class PoolSolveurs
+{
+private:
+	std::mutex mutex_;
+	std::condition_variable cv_;
+	std::deque<Lot> lots_;	// Lots en attente d'un solveur
+	bool arret_ = false;	// Demande d'arrêt des threads
+	std::mutex mutexFaits_;
+	std::vector<Resultat> faits_; // Résultats non encore récupérés
+	int reveil_;				  // Extrémité en écriture du tube de réveil
+	std::atomic<int> enCours_;	  // Lots soumis et non terminés
+	std::atomic<long> resolutions_;
+	std::vector<std::thread> threads_;
+
+public:
+	/**
+	 * @brief Démarre nbThreads solveurs
+	 * @param nbThreads Nombre de threads
+	 * @param reveil Descripteur sur lequel écrire un octet à chaque lot terminé
+	 */
+	PoolSolveurs(int nbThreads, int reveil) : reveil_(reveil), enCours_(0), resolutions_(0)
+	{
+		for (int k = 0; k < nbThreads; ++k)
+			threads_.emplace_back([this]
+								  { travailler(); });
+	}
+
+	~PoolSolveurs()
+	{
+		{
+			std::lock_guard<std::mutex> verrou(mutex_);
+			arret_ = true;
+		}
+		cv_.notify_all();
+		for (std::thread &th : threads_)
+			th.join();
+	}
+
+	/**
+	 * @brief Confie un lot au premier solveur libre
+	 */
+	void soumettre(Lot &&lot)
+	{
+		++enCours_;
+		{
+			std::lock_guard<std::mutex> verrou(mutex_);
+			lots_.push_back(std::move(lot));
+		}
+		cv_.notify_one();
+	}
+
+	/**
+	 * @brief Ajoute à sortie les résultats produits depuis le dernier appel
+	 */
+	void recuperer(std::vector<Resultat> &sortie)
+	{
+		std::lock_guard<std::mutex> verrou(mutexFaits_);
+		sortie.insert(sortie.end(), faits_.begin(), faits_.end());
+		faits_.clear();
+	}
+
+	/**
+	 * @brief Vrai si un solveur au moins n'a pas de lot
+	 */
+	bool libre() const { return enCours_ < (int)threads_.size(); }
+
+	/**
+	 * @brief Vrai si aucun lot n'est en cours ; tous les résultats sont alors dans la file
+	 */
+	bool inactif() const { return enCours_ == 0; }
+
+	long getResolutions() const { return resolutions_; }
+
+private:
+	void travailler()
+	{
+		std::map<CleLot, SolveurChaud> cache;
+		std::vector<Resultat> resultats;
+		for (;;)
+		{
+			Lot lot;
+			{
+				std::unique_lock<std::mutex> verrou(mutex_);
+				cv_.wait(verrou, [this]
+						 { return arret_ || !lots_.empty(); });
+				if (lots_.empty())
+					return;
+				lot = std::move(lots_.front());
+				lots_.pop_front();
+			}
+
+			traiter(lot, cache, resultats);
+
+			{
+				std::lock_guard<std::mutex> verrou(mutexFaits_);
+				faits_.insert(faits_.end(), resultats.begin(), resultats.end());
+			}
+			--enCours_;
+			char octet = 0;
+			while (write(reveil_, &octet, 1) < 0 && errno == EINTR)
+			{
+			}
+		}
+	}
+
+	/**
+	 * @brief Valide les requêtes du lot, les évalue ensemble et remplit resultats
+	 *
+	 * La clé du lot est valide (CleLot::valide) : les requêtes invalides sont écartées avant le regroupement.
+	 */
+	void traiter(const Lot &lot, std::map<CleLot, SolveurChaud> &cache, std::vector<Resultat> &resultats)
+	{
+		const CleLot &cle = lot.cle;
+		const size_t n = lot.entrees.size();
+		resultats.resize(n);
+		for (size_t k = 0; k < n; ++k)
+		{
+			resultats[k].connexion = lot.entrees[k].connexion;
+			resultats[k].reponse.id_ = lot.entrees[k].requete.id_;
+			resultats[k].reponse.statut_ = ReponseInvalide;
+			resultats[k].reponse.prix_ = 0.0;
+		}
+
+		// Requêtes valides du lot, évaluées en un appel
+		std::vector<Scenario> scenarios;
+		std::vector<size_t> indices;
+		for (size_t k = 0; k < n; ++k)
+		{
+			const RequetePrix &q = lot.entrees[k].requete;
+			if (!(q.sigma_ > 0.0) || !std::isfinite(q.sigma_) || !std::isfinite(q.r_))
+				continue;
+			if (!(q.S_ >= 0.0 && q.S_ <= cle.Smax))
+			{
+				resultats[k].reponse.statut_ = ReponseHorsGrille;
+				continue;
+			}
+			scenarios.push_back({q.S_, q.sigma_, q.r_});
+			indices.push_back(k);
+		}
+
+		if (!scenarios.empty())
+		{
+			try
+			{
+				SolveurChaud &solveur = moteur(cle, cache);
+				std::vector<double> prix = solveur.moteur->evaluer(scenarios);
+				resolutions_ += solveur.moteur->getNbResolutions();
+				for (size_t k = 0; k < indices.size(); ++k)
+				{
+					resultats[indices[k]].reponse.statut_ = ReponseOk;
+					resultats[indices[k]].reponse.prix_ = prix[k];
+				}
+			}
+			catch (const std::exception &)
+			{
+				// Les requêtes du lot restent en ReponseInvalide
+			}
+		}
+
+		Horloge::time_point fin = Horloge::now();
+		for (size_t k = 0; k < n; ++k)
+			resultats[k].latence = std::chrono::duration<float, std::micro>(fin - lot.entrees[k].recu).count();
+	}
+
+	/**
+	 * @brief Moteur du contrat et de la grille cle, construit au premier lot qui les demande
+	 */
+	static SolveurChaud &moteur(const CleLot &cle, std::map<CleLot, SolveurChaud> &cache)
+	{
+		std::map<CleLot, SolveurChaud>::iterator it = cache.find(cle);
+		if (it != cache.end())
+			return it->second;
+
+		// Cache borné : au-delà, les moteurs les plus anciens ne se distinguent pas des autres
+		if (cache.size() >= 64)
+			cache.clear();
+
+		std::vector<double> S(cle.N + 1), t(cle.M + 1);
+		for (uint32_t j = 0; j <= cle.N; ++j)
+			S[j] = j * cle.Smax / cle.N;
+		for (uint32_t m = 0; m <= cle.M; ++m)
+			t[m] = m * cle.T / cle.M;
+
+		SolveurChaud &solveur = cache[cle];
+		if (cle.type == RequeteCall)
+			solveur.option.reset(new Call(cle.K, cle.T));
+		else
+			solveur.option.reset(new Put(cle.K, cle.T));
+		solveur.moteur.reset(new MoteurScenarios(*solveur.option, Actif(cle.K), S, t));
+		return solveur;
+	}
+};
+
+/**
+ * @struct Connexion
+ * @brief Tampons d'une connexion cliente
+ */
+struct Connexion
+{
+	int fd;
+	std::string entree; // Octets reçus, pas encore découpés en requêtes
+	std::string sortie; // Réponses pas encore écrites
+};
+
+/**
+ * @brief Lit la valeur d'une option de la forme --nom=valeur
+ * @return true si l'argument correspond à l'option
+ */
+bool lireOption(const std::string &arg, const std::string &nom, std::string &valeur)
+{
+	std::string prefixe = "--" + nom + "=";
+	if (arg.compare(0, prefixe.size(), prefixe) != 0)
+		return false;
+	valeur = arg.substr(prefixe.size());
+	return true;
+}
+
+bool rendreNonBloquant(int fd)
+{
+	int drapeaux = fcntl(fd, F_GETFL, 0);
+	return drapeaux >= 0 && fcntl(fd, F_SETFL, drapeaux | O_NONBLOCK) == 0;
+}
+
+/**
+ * @brief Écrit autant que possible du tampon de sortie
+ * @return false si la connexion est rompue
+ */
+bool ecrire(Connexion &c)
+{
+	size_t ecrits = 0;
+	while (ecrits < c.sortie.size())
+	{
+		ssize_t k = send(c.fd, c.sortie.data() + ecrits, c.sortie.size() - ecrits, MSG_NOSIGNAL);
+		if (k > 0)
+			ecrits += (size_t)k;
+		else if (k < 0 && errno == EINTR)
+			continue;
+		else if (k < 0 && (errno == EAGAIN || errno == EWOULDBLOCK))
+			break;
+		else
+			return false;
+	}
+	c.sortie.erase(0, ecrits);
+	return true;
+}
+
+/**
+ * @brief Quantile q d'un échantillon trié
+ */
+double quantile(const std::vector<float> &trie, double q)
+{
+	return trie[std::min(trie.size() - 1, (size_t)(q * trie.size()))];
+}
+
+} // namespace
+
+int main(int argc, char **argv)
+{
+	std::string chemin = "/tmp/bs_serveur.sock";
+	int nbThreads = 0;
+	double fenetreUs = 0.0;
+	size_t lotMax = 4096;
+	for (int i = 1; i < argc; ++i)
+	{
+		std::string arg = argv[i], valeur;
+		if (lireOption(arg, "socket", valeur))
+			chemin = valeur;
+		else if (lireOption(arg, "threads", valeur))
+			nbThreads = std::atoi(valeur.c_str());
+		else if (lireOption(arg, "fenetre-us", valeur))
+			fenetreUs = std::atof(valeur.c_str());
+		else if (lireOption(arg, "lot-max", valeur))
+			lotMax = (size_t)std::max(1, std::atoi(valeur.c_str()));
+		else
+		{
+			std::cerr << "Option inconnue : " << arg << "\n";
+			return 1;
+		}
+	}
+	if (nbThreads <= 0)
+		nbThreads = std::max(1u, std::thread::hardware_concurrency());
+
+	sockaddr_un adresse;
+	std::memset(&adresse, 0, sizeof(adresse));
+	adresse.sun_family = AF_UNIX;
+	if (chemin.size() >= sizeof(adresse.sun_path))
+	{
+		std::cerr << "Chemin de socket trop long : " << chemin << "\n";
+		return 1;
+	}
+	std::strcpy(adresse.sun_path, chemin.c_str());
+
+	int ecoute = socket(AF_UNIX, SOCK_STREAM, 0);
+	unlink(chemin.c_str());
+	if (ecoute < 0 || bind(ecoute, (sockaddr *)&adresse, sizeof(adresse)) < 0 || listen(ecoute, 128) < 0 ||
+		!rendreNonBloquant(ecoute))
+	{
+		std::perror("bs_serveur : socket");
+		return 1;
+	}
+
+	int tube[2];
+	if (pipe(tube) < 0 || !rendreNonBloquant(tube[0]) || !rendreNonBloquant(tube[1]))
+	{
+		std::perror("bs_serveur : pipe");
+		return 1;
+	}
+
+	struct sigaction action;
+	std::memset(&action, 0, sizeof(action));
+	action.sa_handler = surSignal;
+	sigaction(SIGINT, &action, nullptr);
+	sigaction(SIGTERM, &action, nullptr);
+	std::signal(SIGPIPE, SIG_IGN);
+
+	std::cout << "bs_serveur : " << chemin << ", " << nbThreads << " solveur(s)" << std::endl;
+
+	std::map<uint64_t, Connexion> connexions;
+	uint64_t prochaineConnexion = 0;
+	std::vector<Entree> attente;   // Requêtes pas encore confiées aux solveurs
+	std::vector<Resultat> resultats;
+	std::vector<float> latences;   // Latence de chaque requête servie, en microsecondes
+	std::vector<pollfd> fds;
+	std::vector<uint64_t> idsFds;
+	long nbLots = 0, resolutions = 0;
+	bool arret = false, premiere = true;
+	Horloge::time_point debut, fin;
+	const Horloge::duration fenetre = std::chrono::duration_cast<Horloge::duration>(
+		std::chrono::duration<double, std::micro>(fenetreUs));
+
+	{
+		PoolSolveurs pool(nbThreads, tube[1]);
+		for (;;)
+		{
+			if (arretDemande)
+				arret = true;
+
+			// Résultats des solveurs vers les tampons de sortie ; inactif() est lu avant
+			// recuperer() pour qu'aucun résultat ne puisse arriver entre les deux
+			bool inactif = pool.inactif();
+			resultats.clear();
+			pool.recuperer(resultats);
+			for (const Resultat &res : resultats)
+			{
+				latences.push_back(res.latence);
+				std::map<uint64_t, Connexion>::iterator it = connexions.find(res.connexion);
+				if (it != connexions.end())
+					it->second.sortie.append((const char *)&res.reponse, sizeof(ReponsePrix));
+			}
+			if (!resultats.empty())
+				fin = Horloge::now();
+			for (std::map<uint64_t, Connexion>::iterator it = connexions.begin(); it != connexions.end();)
+			{
+				if (!it->second.sortie.empty() && !ecrire(it->second))
+				{
+					close(it->second.fd);
+					it = connexions.erase(it);
+				}
+				else
+					++it;
+			}
+
+			// Constitution des lots : dès qu'un solveur est libre, ou si l'attente est trop longue
+			if (!attente.empty())
+			{
+				bool mur = Horloge::now() - attente.front().recu >= fenetre;
+				if ((mur && pool.libre()) || attente.size() >= lotMax || arret)
+				{
+					std::map<CleLot, Lot> lots;
+					Horloge::time_point maintenant = Horloge::now();
+					for (const Entree &e : attente)
+					{
+						const RequetePrix &q = e.requete;
+						CleLot cle = {q.type_, q.K_, q.T_, q.Smax_, q.N_, q.M_};
+						if (!cle.valide())
+						{
+							// Réponse immédiate, sans passer par un lot
+							ReponsePrix reponse = {};
+							reponse.id_ = q.id_;
+							reponse.statut_ = ReponseInvalide;
+							latences.push_back(std::chrono::duration<float, std::micro>(maintenant - e.recu).count());
+							fin = maintenant;
+							std::map<uint64_t, Connexion>::iterator it = connexions.find(e.connexion);
+							if (it != connexions.end())
+								it->second.sortie.append((const char *)&reponse, sizeof(ReponsePrix));
+							continue;
+						}
+						lots[cle].entrees.push_back(e);
+					}
+					for (std::map<CleLot, Lot>::iterator it = lots.begin(); it != lots.end(); ++it)
+					{
+						it->second.cle = it->first;
+						pool.soumettre(std::move(it->second));
+						++nbLots;
+					}
+					attente.clear();
+					inactif = false;
+				}
+			}
+
+			if (arret && inactif && attente.empty())
+			{
+				bool vide = true;
+				for (const std::pair<const uint64_t, Connexion> &c : connexions)
+					vide = vide && c.second.sortie.empty();
+				if (vide)
+				{
+					resolutions = pool.getResolutions();
+					break;
+				}
+			}
+
+			// Attente d'un événement : données, connexion, lot terminé ou fin de fenêtre
+			fds.clear();
+			idsFds.clear();
+			fds.push_back({tube[0], POLLIN, 0});
+			if (!arret)
+				fds.push_back({ecoute, POLLIN, 0});
+			for (const std::pair<const uint64_t, Connexion> &c : connexions)
+			{
+				fds.push_back({c.second.fd, (short)(POLLIN | (c.second.sortie.empty() ? 0 : POLLOUT)), 0});
+				idsFds.push_back(c.first);
+			}
+			int delai = -1;
+			if (!attente.empty() && pool.libre())
+			{
+				Horloge::duration reste = attente.front().recu + fenetre - Horloge::now();
+				delai = std::max(0, (int)std::ceil(std::chrono::duration<double, std::milli>(reste).count()));
+			}
+			if (poll(fds.data(), fds.size(), delai) < 0 && errno != EINTR)
+			{
+				std::perror("bs_serveur : poll");
+				resolutions = pool.getResolutions();
+				break;
+			}
+
+			char vidange[256];
+			while (read(tube[0], vidange, sizeof(vidange)) > 0)
+			{
+			}
+
+			size_t premier = arret ? 1 : 2;
+			if (!arret && (fds[1].revents & POLLIN))
+			{
+				int fd;
+				while ((fd = accept(ecoute, nullptr, nullptr)) >= 0)
+				{
+					rendreNonBloquant(fd);
+					connexions[prochaineConnexion++].fd = fd;
+				}
+			}
+
+			// Lecture des requêtes ; les connexions fermées ou en erreur sont retirées
+			Horloge::time_point maintenant = Horloge::now();
+			for (size_t k = premier; k < fds.size(); ++k)
+			{
+				if (!fds[k].revents)
+					continue;
+				std::map<uint64_t, Connexion>::iterator it = connexions.find(idsFds[k - premier]);
+				Connexion &c = it->second;
+				bool rompue = (fds[k].revents & (POLLERR | POLLNVAL)) != 0;
+				if (fds[k].revents & (POLLIN | POLLHUP))
+				{
+					char tampon[1 << 16];
+					for (;;)
+					{
+						ssize_t lus = recv(c.fd, tampon, sizeof(tampon), 0);
+						if (lus > 0)
+							c.entree.append(tampon, (size_t)lus);
+						else if (lus < 0 && errno == EINTR)
+							continue;
+						else
+						{
+							rompue = rompue || lus == 0 || (errno != EAGAIN && errno != EWOULDBLOCK);
+							break;
+						}
+					}
+					size_t lu = 0;
+					for (; lu + sizeof(RequetePrix) <= c.entree.size(); lu += sizeof(RequetePrix))
+					{
+						Entree e;
+						e.connexion = it->first;
+						std::memcpy(&e.requete, c.entree.data() + lu, sizeof(RequetePrix));
+						e.recu = maintenant;
+						if (e.requete.type_ == RequeteArret)
+						{
+							arret = true;
+							continue;
+						}
+						if (premiere)
+						{
+							debut = maintenant;
+							premiere = false;
+						}
+						attente.push_back(e);
+					}
+					c.entree.erase(0, lu);
+				}
+				if (!rompue && (fds[k].revents & POLLOUT))
+					rompue = !ecrire(c);
+				if (rompue)
+				{
+					close(c.fd);
+					connexions.erase(it);
+				}
+			}
+		}
+	}
+
+	for (const std::pair<const uint64_t, Connexion> &c : connexions)
+		close(c.second.fd);
+	close(ecoute);
+	unlink(chemin.c_str());
+
+	// Bilan : débit et latence côté serveur
+	std::cout << "bs_serveur : " << latences.size() << " requetes, " << nbLots << " lots, " << resolutions
+			  << " resolutions\n";
+	if (!latences.empty())
+	{
+		double duree = std::chrono::duration<double>(fin - debut).count();
+		std::sort(latences.begin(), latences.end());
+		std::cout << std::fixed << std::setprecision(1) << "  requetes/lot : " << (double)latences.size() / nbLots
+				  << ", debit : " << std::setprecision(0) << latences.size() / duree << " requetes/s\n"
+				  << std::setprecision(1) << "  latence (us) : p50 " << quantile(latences, 0.5) << ", p90 "
+				  << quantile(latences, 0.9) << ", p99 " << quantile(latences, 0.99) << ", p99.9 "
+				  << quantile(latences, 0.999) << ", max " << latences.back() << "\n";
+	}
+	return 0;
+}
@@ -0,0 +1,95 @@
+/**
+ * @file Verification.hpp
+ * @brief Outils communs aux tests : formule fermée de Black-Scholes, grilles uniformes et vérifications
+ */
+
+#ifndef VERIFICATION_HPP
+#define VERIFICATION_HPP
+
+#include <cmath>
+#include <iostream>
+#include <string>
+#include <vector>
+
+/**
+ * @brief Nombre de vérifications en échec depuis le début du test
+ */
+inline int &nbEchecs()
+{
+	static int n = 0;
+	return n;
+}
+
+/**
+ * @brief Vérifie qu'une valeur est proche de la valeur attendue et affiche le résultat
+ * @param nom Nom de la vérification
+ * @param valeur Valeur calculée
+ * @param attendu Valeur attendue
+ * @param tolerance Écart absolu toléré
+ */
+inline void verifierProche(const std::string &nom, double valeur, double attendu, double tolerance)
+{
+	double ecart = std::fabs(valeur - attendu);
+	bool ok = ecart <= tolerance;
+	std::cout << (ok ? "[ OK ] " : "[ECHEC] ") << nom << " : " << valeur << " (attendu " << attendu << ", écart "
+			  << ecart << ", tolérance " << tolerance << ")\n";
+	if (!ok)
+		++nbEchecs();
+}
+
+/**
+ * @brief Vérifie une condition et affiche le résultat
+ * @param nom Nom de la vérification
+ * @param condition Condition attendue
+ */
+inline void verifier(const std::string &nom, bool condition)
+{
+	std::cout << (condition ? "[ OK ] " : "[ECHEC] ") << nom << "\n";
+	if (!condition)
+		++nbEchecs();
+}
+
+/**
+ * @brief Code de sortie du test : 0 si toutes les vérifications ont réussi
+ */
+inline int resultat()
+{
+	if (nbEchecs() == 0)
+	{
+		std::cout << "Toutes les vérifications ont réussi\n";
+		return 0;
+	}
+	std::cout << nbEchecs() << " vérification(s) en échec\n";
+	return 1;
+}
+
+/**
+ * @brief Prix de Black-Scholes d'un call ou d'un put européen
+ * @param call true pour un call, false pour un put
+ * @param S Prix du sous-jacent
+ * @param K Prix d'exercice
+ * @param T Maturité
+ * @param r Taux d'intérêt sans risque
+ * @param sigma Volatilité
+ * @return Prix en formule fermée
+ */
+inline double prixBlackScholes(bool call, double S, double K, double T, double r, double sigma)
+{
+	double d1 = (std::log(S / K) + (r + 0.5 * sigma * sigma) * T) / (sigma * std::sqrt(T));
+	double d2 = d1 - sigma * std::sqrt(T);
+	auto N = [](double x) { return 0.5 * std::erfc(-x / std::sqrt(2.0)); };
+	return call ? S * N(d1) - K * std::exp(-r * T) * N(d2) : K * std::exp(-r * T) * N(-d2) - S * N(-d1);
+}
+
+/**
+ * @brief Construit une grille uniforme [0, xmax] à n points
+ */
+inline std::vector<double> grilleUniforme(int n, double xmax)
+{
+	std::vector<double> g(n);
+	for (int i = 0; i < n; ++i)
+		g[i] = i * xmax / (n - 1);
+	return g;
+}
+
+#endif
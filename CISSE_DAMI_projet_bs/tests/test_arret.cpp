@@ -0,0 +1,35 @@
+/**
+ * @file test_arret.cpp
+ * @brief Arrêt anticipé sur convergence : pas évités et écart à la résolution complète sous la tolérance
+ */
+
+#include "../DifferenceFinie.hpp"
+#include "../EDP.hpp"
+#include "../Option.hpp"
+#include "Verification.hpp"
+
+int main()
+{
+	const double K = 100.0, T = 500.0, Smax = 400.0, tolerance = 1e-6;
+	const int N = 400, M = 2000;
+	std::vector<double> S = grilleUniforme(N + 1, Smax), t = grilleUniforme(M + 1, T);
+	Actif actif(K, 0.05, 0.2);
+	Put put(K, T);
+	EDPComplete edp(put, actif);
+
+	Crank_Nicholson complet(edp, N + 1, M + 1, S, t);
+	std::vector<double> Vcomplet = complet.solveInitiale();
+	verifier("sans tolérance, aucun pas évité", complet.getPasEconomises() == 0);
+
+	Crank_Nicholson anticipe(edp, N + 1, M + 1, S, t);
+	anticipe.setTolerance(tolerance);
+	std::vector<double> Vanticipe = anticipe.solveInitiale();
+	verifier("arrêt anticipé : des pas sont évités", anticipe.getPasEconomises() > 0);
+
+	double ecart = 0.0;
+	for (int j = 0; j <= N; ++j)
+		ecart = std::max(ecart, std::fabs(Vanticipe[j] - Vcomplet[j]));
+	verifierProche("écart maximal à la résolution complète", ecart, 0.0, tolerance);
+
+	return resultat();
+}
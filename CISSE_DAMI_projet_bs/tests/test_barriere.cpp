@@ -0,0 +1,65 @@
+/**
+ * @file test_barriere.cpp
+ * @brief Options à barrière : désactivante et activante par parité face aux formules fermées
+ */
+
+#include "../DifferenceFinie.hpp"
+#include "../EDP.hpp"
+#include "../Option.hpp"
+#include "Verification.hpp"
+#include <stdexcept>
+
+/**
+ * @brief Call down-and-in (K >= B, sans rebate) en formule fermée
+ */
+static double callDownIn(double S, double K, double B, double T, double r, double sigma)
+{
+	double lambda = (r + 0.5 * sigma * sigma) / (sigma * sigma);
+	double y = std::log(B * B / (S * K)) / (sigma * std::sqrt(T)) + lambda * sigma * std::sqrt(T);
+	auto N = [](double x) { return 0.5 * std::erfc(-x / std::sqrt(2.0)); };
+	return S * std::pow(B / S, 2.0 * lambda) * N(y) -
+		   K * std::exp(-r * T) * std::pow(B / S, 2.0 * lambda - 2.0) * N(y - sigma * std::sqrt(T));
+}
+
+int main()
+{
+	const double K = 100.0, T = 1.0, r = 0.05, sigma = 0.2, B = 90.0, Smax = 300.0;
+	const int M = 400;
+	std::vector<double> t = grilleUniforme(M + 1, T);
+	Actif actif(K, r, sigma);
+	Call call(K, T);
+	OptionBarriere barriere(call, Barriere::Basse, B);
+
+	// Même pas de 0.5 sur les deux grilles, qui partagent l'extrémité Smax
+	std::vector<double> S = grilleUniforme(601, Smax);
+	std::vector<double> Sb = grilleBarriere(barriere, Smax, 421);
+	EDPComplete edp(call, actif), edpBarriere(barriere, actif);
+	Crank_Nicholson cn(edp, (int)S.size(), M + 1, S, t), cnBarriere(edpBarriere, (int)Sb.size(), M + 1, Sb, t);
+	cn.setRannacher(2);
+	cnBarriere.setRannacher(2);
+	std::vector<double> vanille = cn.solveInitiale(), desactivante = cnBarriere.solveInitiale();
+
+	const double attenduIn = callDownIn(K, K, B, T, r, sigma);
+	const double attenduOut = prixBlackScholes(true, K, K, T, r, sigma) - attenduIn;
+	verifierProche("call down-and-out", desactivante[20], attenduOut, 2e-3);
+
+	std::vector<double> activante = pariteActivante(S, vanille, barriere, Sb, desactivante);
+	verifierProche("call down-and-in par parité", activante[200], attenduIn, 2e-3);
+	verifier("activante = vanille sous la barrière", activante[100] == vanille[100]);
+	verifier("activante = vanille sur la barrière", activante[180] == vanille[180]);
+
+	// Grille de la vanille au-delà de l'extrémité de la désactivante : refusée
+	std::vector<double> Slarge = grilleUniforme(801, 400.0), vanilleLarge(Slarge.size(), 0.0);
+	bool refusee = false;
+	try
+	{
+		pariteActivante(Slarge, vanilleLarge, barriere, Sb, desactivante);
+	}
+	catch (const std::invalid_argument &)
+	{
+		refusee = true;
+	}
+	verifier("grille de la vanille plus large que celle de la désactivante refusée", refusee);
+
+	return resultat();
+}
@@ -0,0 +1,49 @@
+/**
+ * @file test_compact.cpp
+ * @brief Schéma compact d'ordre 4 face à la formule fermée, et ordre de convergence en espace
+ */
+
+#include "../DifferenceFinie.hpp"
+#include "../EDP.hpp"
+#include "../Option.hpp"
+#include "Verification.hpp"
+#include <stdexcept>
+
+int main()
+{
+	const double K = 100.0, T = 1.0, r = 0.05, sigma = 0.2;
+	const int M = 400;
+	std::vector<double> t = grilleUniforme(M + 1, T);
+	Actif actif(K, r, sigma);
+	Call call(K, T);
+	EDPComplete edp(call, actif);
+	const double attendu = prixBlackScholes(true, K, K, T, r, sigma);
+
+	// Erreur en S = K (noeud central) pour deux finesses de grille
+	double erreurs[2];
+	const int tailles[2] = {50, 100};
+	for (int k = 0; k < 2; ++k)
+	{
+		int N = tailles[k];
+		std::vector<double> S = grilleLog(K * std::exp(-1.6), K * std::exp(1.6), N + 1);
+		CompactOrdre4 schema(edp, N + 1, M + 1, S, t);
+		erreurs[k] = std::fabs(schema.solve()[0][N / 2] - attendu);
+	}
+	verifierProche("CompactOrdre4 call, 100 intervalles", erreurs[1], 0.0, 5e-3);
+	verifier("CompactOrdre4 : l'erreur décroît avec le pas", erreurs[1] < erreurs[0]);
+
+	// Une grille uniforme en S est refusée
+	bool refusee = false;
+	try
+	{
+		std::vector<double> S = grilleUniforme(101, 300.0);
+		CompactOrdre4 schema(edp, 101, M + 1, S, t);
+	}
+	catch (const std::invalid_argument &)
+	{
+		refusee = true;
+	}
+	verifier("CompactOrdre4 : grille non logarithmique refusée", refusee);
+
+	return resultat();
+}
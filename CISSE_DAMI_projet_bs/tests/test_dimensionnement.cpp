@@ -0,0 +1,59 @@
+/**
+ * @file test_dimensionnement.cpp
+ * @brief Dimensionnement automatique : tolérance atteinte face à la formule fermée, cas à volatilité quasi nulle et volatilité locale refusée
+ */
+
+#include "../Dimensionnement.hpp"
+#include "../Marche.hpp"
+#include "Verification.hpp"
+#include <memory>
+#include <stdexcept>
+
+int main()
+{
+	// Prix à 1e-4 près
+	{
+		Actif actif(100.0, 0.05, 0.2);
+		Call call(100.0, 1.0);
+		Dimensionnement d = dimensionnerGrille(call, actif, 1e-4);
+		verifier("prix : tolérance atteinte", d.atteinte);
+		verifierProche("prix : formule fermée", d.valeur, prixBlackScholes(true, 100.0, 100.0, 1.0, 0.05, 0.2), 2e-4);
+	}
+
+	// Volatilité quasi nulle, call très en dedans : le domaine cible est à peine plus grand que S0
+	{
+		Actif actif(100.0, 0.05, 0.001);
+		Call call(90.0, 0.01);
+		for (Grandeur grandeur : {Grandeur::Prix, Grandeur::Delta, Grandeur::Gamma})
+		{
+			Dimensionnement d = dimensionnerGrille(call, actif, 1e-4, grandeur);
+			int j0 = (int)std::lround(100.0 / (d.Smax / d.N));
+			verifier("volatilité quasi nulle : S0 noeud intérieur", j0 >= 1 && j0 + 1 <= d.N && d.Smax >= 200.0);
+			verifier("volatilité quasi nulle : valeur finie", std::isfinite(d.valeur));
+		}
+		verifierProche("volatilité quasi nulle : prix", dimensionnerGrille(call, actif, 1e-4).valeur,
+					   100.0 - 90.0 * std::exp(-0.05 * 0.01), 1e-3);
+		verifierProche("volatilité quasi nulle : delta", dimensionnerGrille(call, actif, 1e-4, Grandeur::Delta).valeur,
+					   1.0, 1e-3);
+	}
+
+	// Volatilité locale : sigma_ ne dit rien du domaine, le dimensionnement refuse plutôt que de se tromper
+	{
+		Actif actif(100.0, 0.05, 0.01);
+		actif.volLocale_ = std::make_shared<VolLocale>(std::vector<double>{50.0, 150.0}, std::vector<double>{0.0, 1.0},
+													   std::vector<double>(4, 0.6));
+		Call call(100.0, 1.0);
+		bool refuse = false;
+		try
+		{
+			dimensionnerGrille(call, actif, 1e-4);
+		}
+		catch (const std::invalid_argument &)
+		{
+			refuse = true;
+		}
+		verifier("volatilité locale refusée", refuse);
+	}
+
+	return resultat();
+}
@@ -0,0 +1,67 @@
+/**
+ * @file test_dividende.cpp
+ * @brief Dividendes discrets : cas limites face à la formule fermée, parité call-put et bord supérieur d'une grille tronquée
+ */
+
+#include "../DifferenceFinie.hpp"
+#include "../EDP.hpp"
+#include "../Option.hpp"
+#include "Verification.hpp"
+
+/**
+ * @brief Prix Crank-Nicholson en S0 d'un call ou d'un put avec un dividende D versé en td
+ */
+static double prixDividende(bool call, double S0, double K, double T, double r, double sigma, double td, double D,
+							double Smax, int N, int M)
+{
+	std::vector<double> S = grilleUniforme(N + 1, Smax), t = grilleUniforme(M + 1, T);
+	Actif actif(S0, r, sigma);
+	actif.dividendes_.push_back({td, D});
+	Call c(K, T);
+	Put p(K, T);
+	Option &option = call ? static_cast<Option &>(c) : static_cast<Option &>(p);
+	EDPComplete edp(option, actif);
+	Crank_Nicholson cn(edp, N + 1, M + 1, S, t);
+	cn.setRannacher(2);
+	std::vector<double> V = cn.solveInitiale();
+	double x = S0 / (Smax / N);
+	int j = (int)x;
+	return V[j] + (x - j) * (V[j + 1] - V[j]);
+}
+
+int main()
+{
+	const double S0 = 100.0, K = 100.0, T = 1.0, r = 0.05, sigma = 0.2, D = 5.0, Smax = 300.0;
+	const int N = 600, M = 400;
+
+	// Versé juste avant l'échéance : payoff (S - D - K)+, soit un call de strike K + D
+	for (bool call : {true, false})
+	{
+		const std::string nom = call ? "call" : "put";
+		verifierProche("dividende à l'échéance, " + nom, prixDividende(call, S0, K, T, r, sigma, T - 1e-6, D, Smax, N, M),
+					   prixBlackScholes(call, S0, K + D, T, r, sigma), 2e-3);
+	}
+
+	// Versé juste après t = 0 : option sur un sous-jacent qui part de S0 - D
+	for (bool call : {true, false})
+	{
+		const std::string nom = call ? "call" : "put";
+		verifierProche("dividende en t -> 0, " + nom, prixDividende(call, S0, K, T, r, sigma, 1e-6, D, Smax, N, M),
+					   prixBlackScholes(call, S0 - D, K, T, r, sigma), 2e-3);
+	}
+
+	// Parité à mi-vie : C - P = S0 - D e^{-r td} - K e^{-rT}
+	const double td = 0.5;
+	verifierProche("parité avec dividende",
+				   prixDividende(true, S0, K, T, r, sigma, td, D, Smax, N, M) -
+					   prixDividende(false, S0, K, T, r, sigma, td, D, Smax, N, M),
+				   S0 - D * std::exp(-r * td) - K * std::exp(-r * T), 2e-3);
+
+	// Grille tronquée à 1.4 S0 : le bord supérieur du call doit déduire le dividende encore à verser,
+	// pour retrouver le call de strike K + D sans dividende résolu sur la même grille
+	verifierProche("bord supérieur avec dividende",
+				   prixDividende(true, S0, K, T, r, sigma, T - 1e-6, D, 140.0, 280, M),
+				   prixDividende(true, S0, K + D, T, r, sigma, T - 1e-6, 0.0, 140.0, 280, M), 1e-9);
+
+	return resultat();
+}
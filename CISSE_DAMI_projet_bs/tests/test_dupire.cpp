@@ -0,0 +1,41 @@
+/**
+ * @file test_dupire.cpp
+ * @brief Équation forward de Dupire : chaîne de calls et puts face à la formule fermée
+ */
+
+#include "../Dupire.hpp"
+#include "Verification.hpp"
+#include <stdexcept>
+
+int main()
+{
+	const double S0 = 100.0, r = 0.05, sigma = 0.2;
+	Actif actif(S0, r, sigma);
+	Dupire dupire(actif, grilleUniforme(801, 400.0), grilleUniforme(401, 2.0));
+	std::vector<std::vector<double>> C = dupire.solve();
+
+	double ecartCall = 0.0, ecartPut = 0.0;
+	for (double K = 60.0; K <= 140.0; K += 10.0)
+	{
+		for (double T = 0.25; T <= 2.0; T += 0.25)
+		{
+			ecartCall = std::max(ecartCall, std::fabs(dupire.prixCall(C, K, T) - prixBlackScholes(true, S0, K, T, r, sigma)));
+			ecartPut = std::max(ecartPut, std::fabs(dupire.prixPut(C, K, T) - prixBlackScholes(false, S0, K, T, r, sigma)));
+		}
+	}
+	verifierProche("Dupire, écart maximal des calls", ecartCall, 0.0, 5e-3);
+	verifierProche("Dupire, écart maximal des puts", ecartPut, 0.0, 5e-3);
+
+	bool refusee = false;
+	try
+	{
+		dupire.prixCall(C, 500.0, 1.0);
+	}
+	catch (const std::invalid_argument &)
+	{
+		refusee = true;
+	}
+	verifier("strike hors de la grille refusé", refusee);
+
+	return resultat();
+}
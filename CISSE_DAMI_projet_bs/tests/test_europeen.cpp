@@ -0,0 +1,77 @@
+/**
+ * @file test_europeen.cpp
+ * @brief Prix des calls et puts européens par Crank-Nicholson et implicite face à la formule fermée, et résidu de Thomas
+ */
+
+#include "../DifferenceFinie.hpp"
+#include "../EDP.hpp"
+#include "../Option.hpp"
+#include "Verification.hpp"
+#include <type_traits>
+
+// Les schémas ne gardent que l'adresse des grilles : une grille temporaire ne doit pas compiler
+typedef const std::vector<double> &Grille;
+static_assert(!std::is_constructible<Crank_Nicholson, EDP &, int, int, std::vector<double>, Grille>::value, "grille temporaire");
+static_assert(!std::is_constructible<Implicite, EDP &, int, int, Grille, std::vector<double>>::value, "grille temporaire");
+static_assert(!std::is_constructible<BDF2, EDP &, int, int, std::vector<double>, std::vector<double>>::value, "grille temporaire");
+static_assert(std::is_constructible<TR_BDF2, EDP &, int, int, std::vector<double> &, std::vector<double> &>::value, "grille nommée");
+
+int main()
+{
+	const double K = 100.0, T = 1.0, r = 0.05, sigma = 0.2, Smax = 300.0;
+	const int N = 600, M = 400;
+	const int j0 = N / 3; // S = 100
+	std::vector<double> S = grilleUniforme(N + 1, Smax), t = grilleUniforme(M + 1, T);
+	Actif actif(K, r, sigma);
+
+	for (bool estCall : {true, false})
+	{
+		Call call(K, T);
+		Put put(K, T);
+		Option &option = estCall ? static_cast<Option &>(call) : static_cast<Option &>(put);
+		const std::string nom = estCall ? "call" : "put";
+		EDPComplete edp(option, actif);
+		double attendu = prixBlackScholes(estCall, S[j0], K, T, r, sigma);
+
+		Crank_Nicholson cn(edp, N + 1, M + 1, S, t);
+		cn.setRannacher(2);
+		verifierProche("Crank_Nicholson " + nom, cn.solveInitiale()[j0], attendu, 2e-3);
+		verifierProche("Crank_Nicholson solve " + nom, cn.solve()[0][j0], attendu, 2e-3);
+
+		Implicite implicite(edp, N + 1, M + 1, S, t);
+		verifierProche("Implicite " + nom, implicite.solveInitiale()[j0], attendu, 1e-2);
+
+		// Sur toute la zone utile, pas seulement à la monnaie
+		double ecartMax = 0.0;
+		std::vector<double> V = cn.solveInitiale();
+		for (int j = N / 6; j <= N / 2; ++j)
+			ecartMax = std::max(ecartMax, std::fabs(V[j] - prixBlackScholes(estCall, S[j], K, T, r, sigma)));
+		verifierProche("Crank_Nicholson " + nom + ", écart maximal sur [50, 150]", ecartMax, 0.0, 2e-3);
+	}
+
+	// Parité call-put sur la même grille
+	Call call(K, T);
+	Put put(K, T);
+	EDPComplete edpCall(call, actif), edpPut(put, actif);
+	Crank_Nicholson cnCall(edpCall, N + 1, M + 1, S, t), cnPut(edpPut, N + 1, M + 1, S, t);
+	cnCall.setRannacher(2);
+	cnPut.setRannacher(2);
+	verifierProche("parité call-put", cnCall.solveInitiale()[j0] - cnPut.solveInitiale()[j0],
+				   S[j0] - K * std::exp(-r * T), 1e-3);
+
+	// Thomas : résidu de A x = r sur un système diagonalement dominant
+	const int n = 257;
+	std::vector<double> l(n - 1, -1.0), d(n, 4.0), u(n - 1, -1.0), rhs(n);
+	for (int i = 0; i < n; ++i)
+		rhs[i] = std::sin(0.1 * i);
+	std::vector<double> x = ThomasAlgo(l, d, u, rhs);
+	double residu = 0.0;
+	for (int i = 0; i < n; ++i)
+	{
+		double Ax = d[i] * x[i] + (i > 0 ? l[i - 1] * x[i - 1] : 0.0) + (i < n - 1 ? u[i] * x[i + 1] : 0.0);
+		residu = std::max(residu, std::fabs(Ax - rhs[i]));
+	}
+	verifierProche("ThomasAlgo, résidu", residu, 0.0, 1e-12);
+
+	return resultat();
+}
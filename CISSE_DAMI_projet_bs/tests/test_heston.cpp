@@ -0,0 +1,30 @@
+/**
+ * @file test_heston.cpp
+ * @brief Solveur ADI de Heston : prix de référence par fonction caractéristique et indépendance au nombre de threads
+ */
+
+#include "../Heston.hpp"
+#include "Verification.hpp"
+
+int main()
+{
+	const double K = 100.0, T = 1.0;
+	std::vector<double> S = grilleUniforme(200, 400.0), v = grilleUniforme(100, 1.0), t = grilleUniforme(100, T);
+	Actif actif(K, 0.025);
+	Call call(K, T);
+	ParametresHeston p = {1.5, 0.04, 0.3, -0.9};
+
+	Heston heston1(call, actif, p, S, v, t, 1);
+	std::vector<std::vector<double>> V1 = heston1.solve();
+	// Référence : formule par fonction caractéristique, 8.89487
+	verifierProche("Heston call", heston1.prixEn(V1, K, 0.04), 8.89487, 1e-2);
+
+	// Découpage fixe : résultat identique au bit près pour tout nombre de threads
+	for (int nbThreads : {2, 3, 7})
+	{
+		Heston heston(call, actif, p, S, v, t, nbThreads);
+		verifier("Heston, " + std::to_string(nbThreads) + " threads identique à 1 thread", heston.solve() == V1);
+	}
+
+	return resultat();
+}
@@ -0,0 +1,57 @@
+/**
+ * @file test_interface_c.cpp
+ * @brief Interface C : validation des grilles, prix face à la formule fermée et cohérence des trois points d'entrée
+ */
+
+#include "../bs_c.h"
+#include "Verification.hpp"
+
+int main()
+{
+	const double K = 100.0, T = 1.0, Smax = 300.0;
+	const int nS = 601, nt = 401;
+	std::vector<double> S = grilleUniforme(nS, Smax), t = grilleUniforme(nt, T);
+
+	verifier("version", bs_version() == BS_C_VERSION);
+
+	// Grilles refusées : non croissante, non uniforme, trop petite, tronquée
+	bs_contexte *ctx = nullptr;
+	std::vector<double> decroissante(S.rbegin(), S.rend());
+	verifier("grille décroissante refusée", bs_contexte_creer(decroissante.data(), nS, t.data(), nt, 0.5, &ctx) == BS_ERREUR_ARGUMENT && !ctx);
+	std::vector<double> retour(S);
+	retour[nS / 2] = retour[nS / 2 - 2];
+	verifier("grille non monotone refusée", bs_contexte_creer(retour.data(), nS, t.data(), nt, 0.5, &ctx) == BS_ERREUR_ARGUMENT);
+	std::vector<double> irreguliere(S);
+	irreguliere[nS - 1] += 1.0;
+	verifier("grille non uniforme refusée", bs_contexte_creer(irreguliere.data(), nS, t.data(), nt, 0.5, &ctx) == BS_ERREUR_ARGUMENT);
+	std::vector<double> tIrreguliere(t);
+	tIrreguliere[1] *= 0.5;
+	verifier("grille des temps non uniforme refusée", bs_contexte_creer(S.data(), nS, tIrreguliere.data(), nt, 0.5, &ctx) == BS_ERREUR_ARGUMENT);
+	verifier("grille trop petite refusée", bs_contexte_creer(S.data(), 2, t.data(), nt, 0.5, &ctx) == BS_ERREUR_ARGUMENT);
+	std::vector<double> tronquee(S);
+	for (double &x : tronquee)
+		x += 50.0;
+	verifier("grille tronquée en S[0] > 0 refusée", bs_contexte_creer(tronquee.data(), nS, t.data(), nt, 0.5, &ctx) == BS_ERREUR_ARGUMENT);
+
+	verifier("contexte créé", bs_contexte_creer(S.data(), nS, t.data(), nt, 0.5, &ctx) == BS_OK && ctx);
+	bs_contexte_rannacher(ctx, 2);
+
+	bs_contrat contrats[2] = {{BS_CALL, K, 0.05, 0.2}, {BS_PUT, K, 0.05, 0.2}};
+	double spots[2] = {95.25, 110.0}, prix[2];
+	verifier("bs_prix_spots", bs_prix_spots(ctx, contrats, spots, 2, prix) == BS_OK);
+	verifierProche("bs_prix_spots call", prix[0], prixBlackScholes(true, spots[0], K, T, 0.05, 0.2), 2e-3);
+	verifierProche("bs_prix_spots put", prix[1], prixBlackScholes(false, spots[1], K, T, 0.05, 0.2), 2e-3);
+
+	// La couche t = 0 de la surface est celle de bs_prix_initiaux
+	std::vector<double> initiaux(nS), surface((size_t)nS * nt);
+	verifier("bs_prix_initiaux", bs_prix_initiaux(ctx, contrats, 1, initiaux.data(), nS) == BS_OK);
+	verifier("bs_surface", bs_surface(ctx, contrats, surface.data(), nS) == BS_OK);
+	verifier("surface en t = 0 identique à bs_prix_initiaux",
+			 std::vector<double>(surface.begin(), surface.begin() + nS) == initiaux);
+
+	bs_contrat invalide = {BS_CALL, -1.0, 0.05, 0.2};
+	verifier("contrat invalide refusé", bs_prix_initiaux(ctx, &invalide, 1, initiaux.data(), nS) == BS_ERREUR_ARGUMENT);
+
+	bs_contexte_detruire(ctx);
+	return resultat();
+}
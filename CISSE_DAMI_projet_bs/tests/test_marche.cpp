@@ -0,0 +1,45 @@
+/**
+ * @file test_marche.cpp
+ * @brief Volatilité locale et courbe de taux : cas dégénérés face à la formule fermée
+ */
+
+#include "../DifferenceFinie.hpp"
+#include "../EDP.hpp"
+#include "../Marche.hpp"
+#include "../Option.hpp"
+#include "Verification.hpp"
+#include <memory>
+
+int main()
+{
+	const double K = 100.0, T = 1.0, r = 0.05, sigma = 0.2, Smax = 300.0;
+	const int N = 600, M = 400, j0 = N / 3;
+	std::vector<double> S = grilleUniforme(N + 1, Smax), t = grilleUniforme(M + 1, T);
+	Call call(K, T);
+
+	// Surface de volatilité locale constante : même prix qu'à volatilité constante
+	Actif actifVol(K, r, 0.5);
+	std::vector<double> piliersS = {50.0, 100.0, 200.0}, piliersT = {0.0, 0.5, 1.0};
+	actifVol.volLocale_ = std::make_shared<VolLocale>(piliersS, piliersT, std::vector<double>(9, sigma));
+	EDPComplete edpVol(call, actifVol);
+	Crank_Nicholson cnVol(edpVol, N + 1, M + 1, S, t);
+	cnVol.setRannacher(2);
+	verifierProche("volatilité locale constante", cnVol.solveInitiale()[j0], prixBlackScholes(true, K, K, T, r, sigma), 2e-3);
+
+	// Courbe de taux croissante : le prix européen ne dépend que du taux moyen
+	Actif actifTaux(K, 0.0, sigma);
+	auto courbe = std::make_shared<CourbeTaux>(std::vector<double>{0.0, 0.5, 1.0}, std::vector<double>{0.01, 0.04, 0.09});
+	actifTaux.courbeTaux_ = courbe;
+	for (bool estCall : {true, false})
+	{
+		Put put(K, T);
+		Option &option = estCall ? static_cast<Option &>(call) : static_cast<Option &>(put);
+		EDPComplete edp(option, actifTaux);
+		Crank_Nicholson cn(edp, N + 1, M + 1, S, t);
+		cn.setRannacher(2);
+		double attendu = prixBlackScholes(estCall, K, K, T, courbe->tauxMoyen(0.0, T), sigma);
+		verifierProche(std::string("courbe de taux, ") + (estCall ? "call" : "put"), cn.solveInitiale()[j0], attendu, 2e-3);
+	}
+
+	return resultat();
+}
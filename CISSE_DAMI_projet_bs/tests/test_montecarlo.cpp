@@ -0,0 +1,75 @@
+/**
+ * @file test_montecarlo.cpp
+ * @brief Monte-Carlo : européen face à la formule fermée, parité asiatique, reproductibilité et validation
+ */
+
+#include "../MonteCarlo.hpp"
+#include "Verification.hpp"
+#include <stdexcept>
+
+/**
+ * @brief Indique si evaluer refuse le nombre de trajectoires
+ */
+static bool refuse(const MonteCarlo &mc, const ContratTrajectoire &contrat, long nbTrajectoires)
+{
+	try
+	{
+		mc.evaluer(contrat, nbTrajectoires);
+	}
+	catch (const std::invalid_argument &)
+	{
+		return true;
+	}
+	return false;
+}
+
+int main()
+{
+	const double S0 = 100.0, K = 100.0, T = 1.0, r = 0.05, sigma = 0.2;
+	Actif actif(S0, r, sigma);
+	const long n = 200000;
+
+	// Européen sans contrôle : à quatre erreurs standard de la formule fermée
+	MonteCarlo mc(actif, 7, 1);
+	mc.setControle(false);
+	ResultatMonteCarlo europeen = mc.evaluer({Payoff::Europeen, true, K, T, 1}, n);
+	verifierProche("européen sans contrôle", europeen.prix, prixBlackScholes(true, S0, K, T, r, sigma), 4.0 * europeen.erreur);
+
+	// Parité asiatique : C - P = exp(-rT) (E[A] - K), E[A] = moyenne des S0 exp(r t_i)
+	const int nbDates = 12;
+	double moyenne = 0.0;
+	for (int i = 1; i <= nbDates; ++i)
+		moyenne += S0 * std::exp(r * i * T / nbDates) / nbDates;
+	ResultatMonteCarlo call = mc.evaluer({Payoff::Asiatique, true, K, T, nbDates}, n);
+	ResultatMonteCarlo put = mc.evaluer({Payoff::Asiatique, false, K, T, nbDates}, n);
+	verifierProche("parité asiatique", call.prix - put.prix, std::exp(-r * T) * (moyenne - K),
+				   4.0 * (call.erreur + put.erreur));
+
+	// Le contrôle réduit l'erreur standard
+	MonteCarlo mcControle(actif, 7, 1);
+	ResultatMonteCarlo controle = mcControle.evaluer({Payoff::Asiatique, true, K, T, nbDates}, n);
+	verifier("le contrôle réduit l'erreur standard", controle.erreur < call.erreur);
+	verifierProche("asiatique avec contrôle", controle.prix, call.prix, 4.0 * call.erreur);
+
+	// Reproductibilité au bit près pour tout nombre de threads
+	ContratTrajectoire lookback = {Payoff::LookbackFlottant, true, 0.0, T, 52};
+	ResultatMonteCarlo reference = MonteCarlo(actif, 11, 1).evaluer(lookback, 50000);
+	for (int nbThreads : {2, 3, 8})
+	{
+		ResultatMonteCarlo r2 = MonteCarlo(actif, 11, nbThreads).evaluer(lookback, 50000);
+		verifier("lookback, " + std::to_string(nbThreads) + " threads identique à 1 thread",
+				 r2.prix == reference.prix && r2.erreur == reference.erreur);
+	}
+
+	// Au moins deux échantillons : quatre trajectoires avec les antithétiques, deux sans
+	ContratTrajectoire asiatique = {Payoff::Asiatique, true, K, T, nbDates};
+	MonteCarlo petit(actif, 1, 1);
+	petit.setControle(false);
+	verifier("3 trajectoires antithétiques refusées", refuse(petit, asiatique, 3));
+	verifier("4 trajectoires antithétiques : erreur finie", std::isfinite(petit.evaluer(asiatique, 4).erreur));
+	petit.setAntithetique(false);
+	verifier("1 trajectoire refusée", refuse(petit, asiatique, 1));
+	verifier("2 trajectoires : erreur finie", std::isfinite(petit.evaluer(asiatique, 2).erreur));
+
+	return resultat();
+}
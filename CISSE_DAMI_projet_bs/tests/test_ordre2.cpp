@@ -0,0 +1,34 @@
+/**
+ * @file test_ordre2.cpp
+ * @brief BDF2 et TR_BDF2 face à la formule fermée, avec peu de pas de temps
+ */
+
+#include "../DifferenceFinie.hpp"
+#include "../EDP.hpp"
+#include "../Option.hpp"
+#include "Verification.hpp"
+
+int main()
+{
+	const double K = 100.0, T = 1.0, r = 0.05, sigma = 0.2, Smax = 300.0;
+	const int N = 600, M = 50, j0 = N / 3;
+	std::vector<double> S = grilleUniforme(N + 1, Smax), t = grilleUniforme(M + 1, T);
+	Actif actif(K, r, sigma);
+
+	for (bool estCall : {true, false})
+	{
+		Call call(K, T);
+		Put put(K, T);
+		Option &option = estCall ? static_cast<Option &>(call) : static_cast<Option &>(put);
+		const std::string nom = estCall ? "call" : "put";
+		EDPComplete edp(option, actif);
+		double attendu = prixBlackScholes(estCall, S[j0], K, T, r, sigma);
+
+		BDF2 bdf2(edp, N + 1, M + 1, S, t);
+		verifierProche("BDF2 " + nom, bdf2.solve()[0][j0], attendu, 5e-3);
+		TR_BDF2 trbdf2(edp, N + 1, M + 1, S, t);
+		verifierProche("TR_BDF2 " + nom, trbdf2.solve()[0][j0], attendu, 5e-3);
+	}
+
+	return resultat();
+}
@@ -0,0 +1,36 @@
+/**
+ * @file test_precision.cpp
+ * @brief Résolutions en float et en précision mixte face à la résolution en double
+ */
+
+#include "../DifferenceFinie.hpp"
+#include "../EDP.hpp"
+#include "../Option.hpp"
+#include "Verification.hpp"
+
+int main()
+{
+	const double K = 100.0, T = 1.0, r = 0.05, sigma = 0.2, Smax = 300.0;
+	const int N = 600, M = 400, j0 = N / 3;
+	std::vector<double> S = grilleUniforme(N + 1, Smax), t = grilleUniforme(M + 1, T);
+	Actif actif(K, r, sigma);
+	Put put(K, T);
+	EDPComplete edp(put, actif);
+	Crank_Nicholson cn(edp, N + 1, M + 1, S, t);
+
+	std::vector<std::vector<double>> Vd = cn.solveAs<double>();
+	std::vector<std::vector<float>> Vf = cn.solveAs<float>();
+	std::vector<std::vector<float>> Vm = cn.solveAs<float, double>();
+
+	double ecartFloat = 0.0, ecartMixte = 0.0;
+	for (int j = 0; j <= N; ++j)
+	{
+		ecartFloat = std::max(ecartFloat, std::fabs(Vf[0][j] - Vd[0][j]));
+		ecartMixte = std::max(ecartMixte, std::fabs(Vm[0][j] - Vd[0][j]));
+	}
+	verifierProche("float, écart maximal au double", ecartFloat, 0.0, 1e-2);
+	verifierProche("mixte, écart maximal au double", ecartMixte, 0.0, 5e-4);
+	verifierProche("double face à la formule fermée", Vd[0][j0], prixBlackScholes(false, S[j0], K, T, r, sigma), 2e-3);
+
+	return resultat();
+}
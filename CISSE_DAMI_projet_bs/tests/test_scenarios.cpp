@@ -0,0 +1,36 @@
+/**
+ * @file test_scenarios.cpp
+ * @brief Moteur de scénarios : prix choqués face à la formule fermée et une résolution par couple (sigma, r)
+ */
+
+#include "../EDP.hpp"
+#include "../Option.hpp"
+#include "../Scenarios.hpp"
+#include "Verification.hpp"
+
+int main()
+{
+	const double K = 100.0, T = 1.0, Smax = 300.0;
+	std::vector<double> S = grilleUniforme(601, Smax), t = grilleUniforme(401, T);
+	Call call(K, T);
+	Actif actif(K);
+	MoteurScenarios moteur(call, actif, S, t);
+
+	std::vector<Scenario> scenarios;
+	for (double sigma : {0.15, 0.25})
+		for (double r : {0.01, 0.05})
+			for (double spot : {80.0, 95.25, 100.0, 120.0})
+				scenarios.push_back({spot, sigma, r});
+
+	std::vector<double> prix = moteur.evaluer(scenarios);
+	verifier("une résolution par couple (sigma, r)", moteur.getNbResolutions() == 4);
+	double ecartMax = 0.0;
+	for (size_t k = 0; k < scenarios.size(); ++k)
+	{
+		const Scenario &sc = scenarios[k];
+		ecartMax = std::max(ecartMax, std::fabs(prix[k] - prixBlackScholes(true, sc.S, K, T, sc.r, sc.sigma)));
+	}
+	verifierProche("écart maximal à la formule fermée", ecartMax, 0.0, 3e-3);
+
+	return resultat();
+}
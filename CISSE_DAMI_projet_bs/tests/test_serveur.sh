@@ -0,0 +1,33 @@
+#!/bin/sh
+# Test de bout en bout du service de pricing, hors ligne : bs_serveur sur une socket
+# temporaire, bs_client qui vérifie les prix, glisse une requête NaN et arrête le serveur.
+# Usage : test_serveur.sh <bs_serveur> <bs_client>
+set -u
+SERVEUR=$1
+CLIENT=$2
+REP=$(mktemp -d "${TMPDIR:-/tmp}/bs_test.XXXXXX") || exit 1
+SOCKET="$REP/bs.sock"
+trap 'kill "$PID" 2>/dev/null; rm -rf "$REP"' EXIT
+
+"$SERVEUR" --socket="$SOCKET" --threads=2 &
+PID=$!
+
+# Attente de la socket (5 s au plus)
+i=0
+while [ ! -S "$SOCKET" ]; do
+	i=$((i + 1))
+	if [ "$i" -gt 50 ] || ! kill -0 "$PID" 2>/dev/null; then
+		echo "ECHEC : bs_serveur ne s'est pas lancé" >&2
+		exit 1
+	fi
+	sleep 0.1
+done
+
+"$CLIENT" --socket="$SOCKET" --requetes=5000 --en-vol=512 --N=100 --M=100 --verifier=500 --invalide --arret
+CODE=$?
+wait "$PID"
+CODE_SERVEUR=$?
+if [ "$CODE" -ne 0 ] || [ "$CODE_SERVEUR" -ne 0 ]; then
+	echo "ECHEC : bs_client $CODE, bs_serveur $CODE_SERVEUR" >&2
+	exit 1
+fi
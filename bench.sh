@@ -0,0 +1,16 @@
+#!/bin/bash
+
+# Benchmark des solveurs (à lancer depuis CISSE_DAMI_projet_bs, comme exec.sh)
+# Les options sont transmises au binaire, ex : ./bench.sh --filter=Thomas --compare=ref.json
+
+# 1. Compilation optimisée (CMake, Release)
+echo "Compilation du benchmark..."
+cmake -S . -B build -DCMAKE_BUILD_TYPE=Release > /dev/null && cmake --build build -j"$(nproc)" --target bs_bench
+
+# 2. Exécution
+if [ $? -eq 0 ]; then
+    ./build/bs_bench "$@"
+else
+    echo "ERREUR : La compilation a échoué."
+    exit 1
+fi
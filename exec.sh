@@ -1,18 +1,24 @@
 #!/bin/bash
 
-# 1. Nettoyage (Optionnel : supprime l'ancien exécutable)
-rm -f projet
+# À lancer depuis CISSE_DAMI_projet_bs
+# Type de build en argument (Release par défaut, Debug pour le débogage)
+BUILD_TYPE=${1:-Release}
 
-# 2. Compilation (Selon les consignes strictes du PDF)
-echo "Compilation en cours..."
-g++ -std=c++11 -g -Wall -Wextra -o projet *.cpp $(pkg-config --cflags --libs sdl2)
+# 1. Configuration et compilation (CMake)
+echo "Compilation en cours ($BUILD_TYPE)..."
+cmake -S . -B build -DCMAKE_BUILD_TYPE="$BUILD_TYPE" > /dev/null && cmake --build build -j"$(nproc)"
 
-# 3. Vérification et Exécution
+# 2. Vérification et Exécution
 # Si la compilation a réussi ($? == 0), on lance le programme
 if [ $? -eq 0 ]; then
     echo "Compilation réussie ! Lancement du projet..."
     echo "--------------------------------------------"
-    ./projet
+    if [ -x build/projet ]; then
+        ./build/projet
+    else
+        # SDL2 absente : version en ligne de commande
+        ./build/bs_cli
+    fi
 else
     echo "ERREUR : La compilation a échoué."
 fi
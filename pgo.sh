@@ -0,0 +1,33 @@
+#!/bin/bash
+
+# Build optimisé par profil (PGO), à lancer depuis CISSE_DAMI_projet_bs
+# Options CMake supplémentaires en argument, ex : ../pgo.sh -DBS_LTO=ON -DBS_NATIVE=ON
+set -e
+
+PROFILS="$(pwd)/_pgo_profile"
+rm -rf "$PROFILS" build-pgo-gen
+
+# 1. Build instrumenté puis exécution de la charge de travail représentative
+cmake -S . -B build-pgo-gen -DCMAKE_BUILD_TYPE=Release -DBS_PGO=GENERATE -DBS_PGO_DIR="$PROFILS" "$@" > /dev/null
+cmake --build build-pgo-gen -j"$(nproc)"
+cmake --build build-pgo-gen --target pgo-train
+
+# Clang écrit des profils bruts (.profraw) : les fusionner dans le default.profdata attendu par BS_PGO=USE
+if grep -q 'CMAKE_CXX_COMPILER_ID "[A-Za-z]*Clang"' build-pgo-gen/CMakeFiles/*/CMakeCXXCompiler.cmake; then
+	if [ -z "$LLVM_PROFDATA" ]; then
+		if command -v llvm-profdata > /dev/null; then
+			LLVM_PROFDATA=llvm-profdata
+		elif command -v xcrun > /dev/null; then
+			LLVM_PROFDATA="xcrun llvm-profdata"
+		else
+			echo "llvm-profdata introuvable : renseigner LLVM_PROFDATA" >&2
+			exit 1
+		fi
+	fi
+	$LLVM_PROFDATA merge -output="$PROFILS/default.profdata" "$PROFILS"/*.profraw
+fi
+
+# 2. Build final utilisant les profils
+cmake -S . -B build-pgo -DCMAKE_BUILD_TYPE=Release -DBS_PGO=USE -DBS_PGO_DIR="$PROFILS" "$@" > /dev/null
+cmake --build build-pgo -j"$(nproc)"
+echo "Build PGO disponible dans build-pgo/"